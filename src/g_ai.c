@@ -124,7 +124,7 @@ ai_stand(edict_t *self, float dist)
 		M_walkmove(self, self->s.angles[YAW], dist);
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		if (self->enemy)
 		{
@@ -132,11 +132,11 @@ ai_stand(edict_t *self, float dist)
 			self->ideal_yaw = vectoyaw(v);
 
 			if ((self->s.angles[YAW] != self->ideal_yaw) &&
-				self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+				self->monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
 			{
-				self->monsterinfo.aiflags &=
+				self->monsterinfo->aiflags &=
 					~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self->monsterinfo.run(self);
+				self->monsterinfo->run(self);
 			}
 
 			M_ChangeYaw(self);
@@ -155,23 +155,23 @@ ai_stand(edict_t *self, float dist)
 		return;
 	}
 
-	if (level.time > self->monsterinfo.pausetime)
+	if (level.time > self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.walk(self);
+		self->monsterinfo->walk(self);
 		return;
 	}
 
-	if (!(self->spawnflags & 1) && (self->monsterinfo.idle) &&
-		(level.time > self->monsterinfo.idle_time))
+	if (!(self->spawnflags & 1) && (self->monsterinfo->idle) &&
+		(level.time > self->monsterinfo->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (self->monsterinfo->idle_time)
 		{
-			self->monsterinfo.idle(self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			self->monsterinfo->idle(self);
+			self->monsterinfo->idle_time = level.time + 15 + random_s(RANDK_AI) * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			self->monsterinfo->idle_time = level.time + random_s(RANDK_AI) * 15;
 		}
 	}
 }
@@ -195,16 +195,16 @@ ai_walk(edict_t *self, float dist)
 		return;
 	}
 
-	if ((self->monsterinfo.search) && (level.time > self->monsterinfo.idle_time))
+	if ((self->monsterinfo->search) && (level.time > self->monsterinfo->idle_time))
 	{
-		if (self->monsterinfo.idle_time)
+		if (self->monsterinfo->idle_time)
 		{
-			self->monsterinfo.search(self);
-			self->monsterinfo.idle_time = level.time + 15 + random() * 15;
+			self->monsterinfo->search(self);
+			self->monsterinfo->idle_time = level.time + 15 + random_s(RANDK_AI) * 15;
 		}
 		else
 		{
-			self->monsterinfo.idle_time = level.time + random() * 15;
+			self->monsterinfo->idle_time = level.time + random_s(RANDK_AI) * 15;
 		}
 	}
 }
@@ -406,13 +406,13 @@ HuntTarget(edict_t *self)
 
 	self->goalentity = self->enemy;
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.stand(self);
+		self->monsterinfo->stand(self);
 	}
 	else
 	{
-		self->monsterinfo.run(self);
+		self->monsterinfo->run(self);
 	}
 
 	if(visible(self, self->enemy))
@@ -423,7 +423,7 @@ HuntTarget(edict_t *self)
 	self->ideal_yaw = vectoyaw(vec);
 
 	/* wait a while before first attack */
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(self->monsterinfo->aiflags & AI_STAND_GROUND))
 	{
 		AttackFinished(self, 1);
 	}
@@ -447,8 +447,8 @@ FoundTarget(edict_t *self)
 
 	self->show_hostile = level.time + 1; /* wake up other monsters */
 
-	VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
-	self->monsterinfo.trail_time = level.time;
+	VectorCopy(self->enemy->s.origin, self->monsterinfo->last_sighting);
+	self->monsterinfo->trail_time = level.time;
 
 	if (!self->combattarget)
 	{
@@ -471,14 +471,14 @@ FoundTarget(edict_t *self)
 
 	/* clear out our combattarget, these are a one shot deal */
 	self->combattarget = NULL;
-	self->monsterinfo.aiflags |= AI_COMBAT_POINT;
+	self->monsterinfo->aiflags |= AI_COMBAT_POINT;
 
 	/* clear the targetname, that point is ours! */
 	self->movetarget->targetname = NULL;
-	self->monsterinfo.pausetime = 0;
+	self->monsterinfo->pausetime = 0;
 
 	/* run for it */
-	self->monsterinfo.run(self);
+	self->monsterinfo->run(self);
 }
 
 /*
@@ -510,13 +510,13 @@ FindTarget(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (self->monsterinfo->aiflags & AI_GOOD_GUY)
 	{
 		return false;
 	}
 
 	/* if we're going to a combat point, just proceed */
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 	{
 		return false;
 	}
@@ -635,9 +635,9 @@ FindTarget(edict_t *self)
 
 		self->enemy = client;
 
-		if (strcmp(self->enemy->classname, "player_noise") != 0)
+		if (G_ClassAtom(self->enemy) != CN_player_noise)
 		{
-			self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+			self->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 			if (!self->enemy->client)
 			{
@@ -691,16 +691,16 @@ FindTarget(edict_t *self)
 		M_ChangeYaw(self);
 
 		/* hunt the sound for a bit; hopefully find the real player */
-		self->monsterinfo.aiflags |= AI_SOUND_TARGET;
+		self->monsterinfo->aiflags |= AI_SOUND_TARGET;
 		self->enemy = client;
 	}
 
 	FoundTarget(self);
 
-	if (!(self->monsterinfo.aiflags & AI_SOUND_TARGET) &&
-		(self->monsterinfo.sight))
+	if (!(self->monsterinfo->aiflags & AI_SOUND_TARGET) &&
+		(self->monsterinfo->sight))
 	{
-		self->monsterinfo.sight(self, self->enemy);
+		self->monsterinfo->sight(self, self->enemy);
 	}
 
 	return true;
@@ -765,30 +765,30 @@ M_CheckAttack(edict_t *self)
 	if (enemy_range == RANGE_MELEE)
 	{
 		/* don't always melee in easy mode */
-		if ((skill->value == SKILL_EASY) && (randk() & 3))
+		if ((skill->value == SKILL_EASY) && (randk_s(RANDK_AI) & 3))
 		{
 			return false;
 		}
 
-		if (self->monsterinfo.melee)
+		if (self->monsterinfo->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			self->monsterinfo->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			self->monsterinfo->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!self->monsterinfo->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 	{
 		return false;
 	}
@@ -798,7 +798,7 @@ M_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -824,22 +824,22 @@ M_CheckAttack(edict_t *self)
 		chance *= 2;
 	}
 
-	if (random() < chance)
+	if (random_s(RANDK_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		self->monsterinfo->attack_state = AS_MISSILE;
+		self->monsterinfo->attack_finished = level.time + 2 * random_s(RANDK_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (random_s(RANDK_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			self->monsterinfo->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -863,9 +863,9 @@ ai_run_melee(edict_t *self)
 
 	if (FacingIdeal(self))
 	{
-		if (self->monsterinfo.melee) {
-			self->monsterinfo.melee(self);
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+		if (self->monsterinfo->melee) {
+			self->monsterinfo->melee(self);
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 }
@@ -887,9 +887,9 @@ ai_run_missile(edict_t *self)
 
 	if (FacingIdeal(self))
 	{
-		if (self->monsterinfo.attack) {
-			self->monsterinfo.attack(self);
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+		if (self->monsterinfo->attack) {
+			self->monsterinfo->attack(self);
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 }
@@ -911,7 +911,7 @@ ai_run_slide(edict_t *self, float distance)
 	self->ideal_yaw = enemy_yaw;
 	M_ChangeYaw(self);
 
-	if (self->monsterinfo.lefty)
+	if (self->monsterinfo->lefty)
 	{
 		ofs = 90;
 	}
@@ -925,7 +925,7 @@ ai_run_slide(edict_t *self, float distance)
 		return;
 	}
 
-	self->monsterinfo.lefty = 1 - self->monsterinfo.lefty;
+	self->monsterinfo->lefty = 1 - self->monsterinfo->lefty;
 	M_walkmove(self, self->ideal_yaw - ofs, distance);
 }
 
@@ -944,7 +944,7 @@ hesDeadJim(const edict_t *self)
 		return true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (self->monsterinfo->aiflags & AI_MEDIC)
 	{
 		return (enemy->health > 0);
 	}
@@ -954,7 +954,7 @@ hesDeadJim(const edict_t *self)
 		return true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_BRUTAL)
+	if (self->monsterinfo->aiflags & AI_BRUTAL)
 	{
 		return (enemy->health <= -80);
 	}
@@ -978,12 +978,12 @@ ai_checkattack(edict_t *self)
 	   to the combat point w/o firing */
 	if (self->goalentity)
 	{
-		if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+		if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 		{
 			return false;
 		}
 
-		if ((self->monsterinfo.aiflags & AI_SOUND_TARGET) && !visible(self, self->goalentity))
+		if ((self->monsterinfo->aiflags & AI_SOUND_TARGET) && !visible(self, self->goalentity))
 		{
 			if ((level.time - self->enemy->last_sound_time) > 5.0)
 			{
@@ -999,11 +999,11 @@ ai_checkattack(edict_t *self)
 					}
 				}
 
-				self->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+				self->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
-				if (self->monsterinfo.aiflags & AI_TEMP_STAND_GROUND)
+				if (self->monsterinfo->aiflags & AI_TEMP_STAND_GROUND)
 				{
-					self->monsterinfo.aiflags &=
+					self->monsterinfo->aiflags &=
 							~(AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
 				}
 			}
@@ -1021,7 +1021,7 @@ ai_checkattack(edict_t *self)
 	if (hesDeadJim(self))
 	{
 		self->enemy = NULL;
-		self->monsterinfo.aiflags &= ~AI_MEDIC;
+		self->monsterinfo->aiflags &= ~AI_MEDIC;
 
 		if (self->oldenemy && (self->oldenemy->health > 0))
 		{
@@ -1034,7 +1034,7 @@ ai_checkattack(edict_t *self)
 			if (self->movetarget)
 			{
 				self->goalentity = self->movetarget;
-				self->monsterinfo.walk(self);
+				self->monsterinfo->walk(self);
 			}
 			else
 			{
@@ -1042,8 +1042,8 @@ ai_checkattack(edict_t *self)
 				   will just revert to walking with no target and
 				   the monsters will wonder around aimlessly trying
 				   to hunt the world entity */
-				self->monsterinfo.pausetime = level.time + 100000000;
-				self->monsterinfo.stand(self);
+				self->monsterinfo->pausetime = level.time + 100000000;
+				self->monsterinfo->stand(self);
 			}
 
 			return true;
@@ -1058,12 +1058,12 @@ ai_checkattack(edict_t *self)
 
 	if (enemy_vis)
 	{
-		self->monsterinfo.search_time = level.time + 5;
-		VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
+		self->monsterinfo->search_time = level.time + 5;
+		VectorCopy(self->enemy->s.origin, self->monsterinfo->last_sighting);
 	}
 
 	/* look for other coop players here */
-	if (coop->value && (self->monsterinfo.search_time < level.time))
+	if (coop->value && (self->monsterinfo->search_time < level.time))
 	{
 		if (FindTarget(self))
 		{
@@ -1079,13 +1079,13 @@ ai_checkattack(edict_t *self)
 		enemy_yaw = vectoyaw(temp);
 	}
 
-	if (self->monsterinfo.attack_state == AS_MISSILE)
+	if (self->monsterinfo->attack_state == AS_MISSILE)
 	{
 		ai_run_missile(self);
 		return true;
 	}
 
-	if (self->monsterinfo.attack_state == AS_MELEE)
+	if (self->monsterinfo->attack_state == AS_MELEE)
 	{
 		ai_run_melee(self);
 		return true;
@@ -1098,7 +1098,7 @@ ai_checkattack(edict_t *self)
 		return false;
 	}
 
-	return self->monsterinfo.checkattack(self);
+	return self->monsterinfo->checkattack(self);
 }
 
 /*
@@ -1125,13 +1125,13 @@ ai_run(edict_t *self, float dist)
 	}
 
 	/* if we're going to a combat point, just proceed */
-	if (self->monsterinfo.aiflags & AI_COMBAT_POINT)
+	if (self->monsterinfo->aiflags & AI_COMBAT_POINT)
 	{
 		M_MoveToGoal(self, dist);
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_SOUND_TARGET)
+	if (self->monsterinfo->aiflags & AI_SOUND_TARGET)
 	{
 		/* Special case: Some projectiles like grenades or rockets are
 		   classified as an enemy. When they explode they generate a
@@ -1146,8 +1146,8 @@ ai_run(edict_t *self, float dist)
 
 			if (VectorLength(v) < 64)
 			{
-				self->monsterinfo.aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
-				self->monsterinfo.stand(self);
+				self->monsterinfo->aiflags |= (AI_STAND_GROUND | AI_TEMP_STAND_GROUND);
+				self->monsterinfo->stand(self);
 				return;
 			}
 		}
@@ -1165,7 +1165,7 @@ ai_run(edict_t *self, float dist)
 		return;
 	}
 
-	if (self->monsterinfo.attack_state == AS_SLIDING)
+	if (self->monsterinfo->attack_state == AS_SLIDING)
 	{
 		ai_run_slide(self, dist);
 		return;
@@ -1174,17 +1174,17 @@ ai_run(edict_t *self, float dist)
 	if (enemy_vis)
 	{
 		M_MoveToGoal(self, dist);
-		self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
-		VectorCopy(self->enemy->s.origin, self->monsterinfo.last_sighting);
-		self->monsterinfo.trail_time = level.time;
+		self->monsterinfo->aiflags &= ~AI_LOST_SIGHT;
+		VectorCopy(self->enemy->s.origin, self->monsterinfo->last_sighting);
+		self->monsterinfo->trail_time = level.time;
 		return;
 	}
 
-	if ((self->monsterinfo.search_time) &&
-		(level.time > (self->monsterinfo.search_time + 20)))
+	if ((self->monsterinfo->search_time) &&
+		(level.time > (self->monsterinfo->search_time + 20)))
 	{
 		M_MoveToGoal(self, dist);
-		self->monsterinfo.search_time = 0;
+		self->monsterinfo->search_time = 0;
 		return;
 	}
 
@@ -1201,32 +1201,32 @@ ai_run(edict_t *self, float dist)
 
 	new = false;
 
-	if (!(self->monsterinfo.aiflags & AI_LOST_SIGHT))
+	if (!(self->monsterinfo->aiflags & AI_LOST_SIGHT))
 	{
 		/* just lost sight of the player, decide where to go first */
-		self->monsterinfo.aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
-		self->monsterinfo.aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
+		self->monsterinfo->aiflags |= (AI_LOST_SIGHT | AI_PURSUIT_LAST_SEEN);
+		self->monsterinfo->aiflags &= ~(AI_PURSUE_NEXT | AI_PURSUE_TEMP);
 		new = true;
 	}
 
-	if (self->monsterinfo.aiflags & AI_PURSUE_NEXT)
+	if (self->monsterinfo->aiflags & AI_PURSUE_NEXT)
 	{
-		self->monsterinfo.aiflags &= ~AI_PURSUE_NEXT;
+		self->monsterinfo->aiflags &= ~AI_PURSUE_NEXT;
 
 		/* give ourself more time since we got this far */
-		self->monsterinfo.search_time = level.time + 5;
+		self->monsterinfo->search_time = level.time + 5;
 
-		if (self->monsterinfo.aiflags & AI_PURSUE_TEMP)
+		if (self->monsterinfo->aiflags & AI_PURSUE_TEMP)
 		{
-			self->monsterinfo.aiflags &= ~AI_PURSUE_TEMP;
+			self->monsterinfo->aiflags &= ~AI_PURSUE_TEMP;
 			marker = NULL;
-			VectorCopy(self->monsterinfo.saved_goal,
-					self->monsterinfo.last_sighting);
+			VectorCopy(self->monsterinfo->saved_goal,
+					self->monsterinfo->last_sighting);
 			new = true;
 		}
-		else if (self->monsterinfo.aiflags & AI_PURSUIT_LAST_SEEN)
+		else if (self->monsterinfo->aiflags & AI_PURSUIT_LAST_SEEN)
 		{
-			self->monsterinfo.aiflags &= ~AI_PURSUIT_LAST_SEEN;
+			self->monsterinfo->aiflags &= ~AI_PURSUIT_LAST_SEEN;
 			marker = PlayerTrail_PickFirst(self);
 		}
 		else
@@ -1236,28 +1236,28 @@ ai_run(edict_t *self, float dist)
 
 		if (marker)
 		{
-			VectorCopy(marker->s.origin, self->monsterinfo.last_sighting);
-			self->monsterinfo.trail_time = marker->timestamp;
+			VectorCopy(marker->s.origin, self->monsterinfo->last_sighting);
+			self->monsterinfo->trail_time = marker->timestamp;
 			self->s.angles[YAW] = self->ideal_yaw = marker->s.angles[YAW];
 			new = true;
 		}
 	}
 
-	VectorSubtract(self->s.origin, self->monsterinfo.last_sighting, v);
+	VectorSubtract(self->s.origin, self->monsterinfo->last_sighting, v);
 	d1 = VectorLength(v);
 
 	if (d1 <= dist)
 	{
-		self->monsterinfo.aiflags |= AI_PURSUE_NEXT;
+		self->monsterinfo->aiflags |= AI_PURSUE_NEXT;
 		dist = d1;
 	}
 
-	VectorCopy(self->monsterinfo.last_sighting, self->goalentity->s.origin);
+	VectorCopy(self->monsterinfo->last_sighting, self->goalentity->s.origin);
 
 	if (new)
 	{
 		tr = gi.trace(self->s.origin, self->mins, self->maxs,
-				self->monsterinfo.last_sighting, self,
+				self->monsterinfo->last_sighting, self,
 				MASK_PLAYERSOLID);
 
 		if (tr.fraction < 1)
@@ -1292,11 +1292,11 @@ ai_run(edict_t *self, float dist)
 							v_right, left_target);
 				}
 
-				VectorCopy(self->monsterinfo.last_sighting,
-						self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy(self->monsterinfo->last_sighting,
+						self->monsterinfo->saved_goal);
+				self->monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy(left_target, self->goalentity->s.origin);
-				VectorCopy(left_target, self->monsterinfo.last_sighting);
+				VectorCopy(left_target, self->monsterinfo->last_sighting);
 				VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 			}
@@ -1309,11 +1309,11 @@ ai_run(edict_t *self, float dist)
 							right_target);
 				}
 
-				VectorCopy(self->monsterinfo.last_sighting,
-						self->monsterinfo.saved_goal);
-				self->monsterinfo.aiflags |= AI_PURSUE_TEMP;
+				VectorCopy(self->monsterinfo->last_sighting,
+						self->monsterinfo->saved_goal);
+				self->monsterinfo->aiflags |= AI_PURSUE_TEMP;
 				VectorCopy(right_target, self->goalentity->s.origin);
-				VectorCopy(right_target, self->monsterinfo.last_sighting);
+				VectorCopy(right_target, self->monsterinfo->last_sighting);
 				VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 				self->s.angles[YAW] = self->ideal_yaw = vectoyaw(v);
 			}
@@ -26,6 +26,82 @@
 
 #include "header/local.h"
 
+/*
+ * Sets the chase target of a player. Every target keeps
+ * a list of its chasers, so only they need to be updated
+ * when it moves. Always change chase_target through here.
+ */
+void
+SetChaseTarget(edict_t *ent, edict_t *targ)
+{
+	gclient_t *cl;
+	edict_t **link;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	cl = ent->client;
+
+	if (cl->chase_target == targ)
+	{
+		return;
+	}
+
+	/* unlink from the old target */
+	if (cl->chase_target)
+	{
+		for (link = &cl->chase_target->client->chasers; *link;
+			 link = &(*link)->client->chase_next)
+		{
+			if (*link == ent)
+			{
+				*link = cl->chase_next;
+				break;
+			}
+		}
+	}
+
+	cl->chase_target = targ;
+	cl->chase_next = NULL;
+
+	if (targ)
+	{
+		cl->chase_next = targ->client->chasers;
+		targ->client->chasers = ent;
+	}
+}
+
+/*
+ * Called when a player leaves, sends
+ * its chasers to the next player.
+ */
+void
+ClearChasers(edict_t *ent)
+{
+	edict_t *other;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	SetChaseTarget(ent, NULL);
+
+	/* UpdateChaseCam() moves them away from
+	   us, so the list gets shorter every time */
+	while ((other = ent->client->chasers))
+	{
+		UpdateChaseCam(other);
+
+		if (ent->client->chasers == other)
+		{
+			SetChaseTarget(other, NULL);
+		}
+	}
+}
+
 void
 UpdateChaseCam(edict_t *ent)
 {
@@ -50,7 +126,7 @@ UpdateChaseCam(edict_t *ent)
 
 		if (ent->client->chase_target == old)
 		{
-			ent->client->chase_target = NULL;
+			SetChaseTarget(ent, NULL);
 			ent->client->ps.pmove.pm_flags &= ~PMF_NO_PREDICTION;
 			return;
 		}
@@ -186,7 +262,7 @@ ChaseNext(edict_t *ent)
 	}
 	while (e != ent->client->chase_target);
 
-	ent->client->chase_target = e;
+	SetChaseTarget(ent, e);
 	ent->client->update_chase = true;
 }
 
@@ -231,7 +307,7 @@ ChasePrev(edict_t *ent)
 	}
 	while (e != ent->client->chase_target);
 
-	ent->client->chase_target = e;
+	SetChaseTarget(ent, e);
 	ent->client->update_chase = true;
 }
 
@@ -252,7 +328,7 @@ GetChaseTarget(edict_t *ent)
 
 		if (other->inuse && !other->client->resp.spectator)
 		{
-			ent->client->chase_target = other;
+			SetChaseTarget(ent, other);
 			ent->client->update_chase = true;
 			UpdateChaseCam(ent);
 			return;
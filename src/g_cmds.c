@@ -24,6 +24,8 @@
  * =======================================================================
  */
 
+#include <ctype.h>
+
 #include "header/local.h"
 #include "monster/misc/player.h"
 
@@ -1424,9 +1426,345 @@ Cmd_SpawnOnStart_f(edict_t *ent)
 	}
 }
 
+/*
+ * listentities
+ *
+ * Lists entities by category and filters, a page at a time.
+ * Categories: all, ammo, items, keys, monsters, weapons.
+ * Filters:
+ *  class <glob>  classname, * and ? are wildcards
+ *  radius <r>    within r units of the player
+ *  movetype <n>  MOVETYPE_*
+ *  svflags <n>   any of the SVF_* bits
+ *  from <n>      start at edict n, the cursor the last page printed
+ *  dump          write all matches to a file in the background
+ */
+
+#define LISTENT_ALL 1
+#define LISTENT_AMMO 2
+#define LISTENT_ITEMS 4
+#define LISTENT_KEYS 8
+#define LISTENT_MONSTERS 16
+#define LISTENT_WEAPONS 32
+
+#define LISTENT_PAGE 1000 /* bytes, stays below the client message size */
+#define LISTENT_DUMPFRAME 128 /* edicts written per frame */
+
+#define LISTENT_MAGIC "KOIE"
+#define LISTENT_VERSION 1
+
+typedef struct
+{
+	int categories;
+	char classname[64]; /* glob, empty for any */
+	float radius; /* 0 for any */
+	vec3_t origin;
+	int movetype; /* -1 for any */
+	int svflags; /* 0 for any */
+} entfilter_t;
+
+static struct
+{
+	FILE *file;
+	entfilter_t filter;
+	char mapname[MAX_QPATH];
+	int next; /* edict to write next */
+	int written;
+} entdump;
+
+static const char *listent_usage =
+	"Usage: listentities <all|ammo|items|keys|monsters|weapons> "
+	"[class <glob>] [radius <r>] [movetype <n>] [svflags <n>] "
+	"[from <n>] [dump]\n";
+
+/*
+ * Case insensitive match of a
+ * glob with * and ? wildcards.
+ */
+static qboolean
+GlobMatch(const char *glob, const char *s)
+{
+	const char *star = NULL;
+	const char *resume = NULL;
+
+	while (*s)
+	{
+		if ((*glob == '?') || (*glob && (tolower((unsigned char)*glob) == tolower((unsigned char)*s))))
+		{
+			glob++;
+			s++;
+		}
+		else if (*glob == '*')
+		{
+			star = glob++;
+			resume = s;
+		}
+		else if (star)
+		{
+			glob = star + 1;
+			s = ++resume;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	while (*glob == '*')
+	{
+		glob++;
+	}
+
+	return !*glob;
+}
+
+static qboolean
+EntityMatches(const edict_t *cur, const entfilter_t *filter)
+{
+	vec3_t v;
+
+	/* Ensure that the entity is valid. */
+	if (!cur->inuse || !cur->classname)
+	{
+		return false;
+	}
+
+	if (!(filter->categories & LISTENT_ALL))
+	{
+		if (!(((filter->categories & LISTENT_AMMO) &&
+			   (strncmp(cur->classname, "ammo_", 5) == 0)) ||
+			  ((filter->categories & LISTENT_ITEMS) &&
+			   (strncmp(cur->classname, "item_", 5) == 0)) ||
+			  ((filter->categories & LISTENT_KEYS) &&
+			   (strncmp(cur->classname, "key_", 4) == 0)) ||
+			  ((filter->categories & LISTENT_MONSTERS) &&
+			   (strncmp(cur->classname, "monster_", 8) == 0)) ||
+			  ((filter->categories & LISTENT_WEAPONS) &&
+			   (strncmp(cur->classname, "weapon_", 7) == 0))))
+		{
+			return false;
+		}
+	}
+
+	if ((filter->movetype >= 0) && (cur->movetype != filter->movetype))
+	{
+		return false;
+	}
+
+	if (filter->svflags && !(cur->svflags & filter->svflags))
+	{
+		return false;
+	}
+
+	if (filter->radius > 0)
+	{
+		VectorSubtract(cur->s.origin, filter->origin, v);
+
+		if (DotProduct(v, v) > filter->radius * filter->radius)
+		{
+			return false;
+		}
+	}
+
+	if (filter->classname[0] && !GlobMatch(filter->classname, cur->classname))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+static void
+DumpWriteByte(int c)
+{
+	fputc(c & 0xff, entdump.file);
+}
+
+static void
+DumpWriteShort(int c)
+{
+	DumpWriteByte(c);
+	DumpWriteByte(c >> 8);
+}
+
+static void
+DumpWriteLong(unsigned int c)
+{
+	DumpWriteShort(c);
+	DumpWriteShort(c >> 16);
+}
+
+static void
+DumpWriteFloat(float f)
+{
+	unsigned int c;
+
+	memcpy(&c, &f, sizeof(c));
+	DumpWriteLong(c);
+}
+
+static void
+DumpWriteString(const char *s)
+{
+	int len;
+
+	len = s ? (int)strlen(s) : 0;
+
+	if (len > 255)
+	{
+		len = 255;
+	}
+
+	DumpWriteByte(len);
+	fwrite(s, 1, len, entdump.file);
+}
+
+/*
+ * Dump format, little endian:
+ *  header: "KOIE", version (long), framenum (long), mapname (MAX_QPATH)
+ *  entity: number (short), movetype, solid (bytes), svflags, flags,
+ *          health (longs), nextthink, origin[3], size[3] (floats),
+ *          classname, targetname (byte length + chars)
+ *  end:    number -1 (short), count (long)
+ */
+static void
+DumpEntity(const edict_t *cur)
+{
+	int j;
+
+	DumpWriteShort(G_NumForEdict(cur));
+	DumpWriteByte(cur->movetype);
+	DumpWriteByte(cur->solid);
+	DumpWriteLong(cur->svflags);
+	DumpWriteLong(cur->flags);
+	DumpWriteLong(cur->health);
+	DumpWriteFloat(cur->nextthink);
+
+	for (j = 0; j < 3; j++)
+	{
+		DumpWriteFloat(cur->s.origin[j]);
+	}
+
+	for (j = 0; j < 3; j++)
+	{
+		DumpWriteFloat(cur->size[j]);
+	}
+
+	DumpWriteString(cur->classname);
+	DumpWriteString(cur->targetname);
+}
+
+void
+G_DumpEntitiesStop(void)
+{
+	if (!entdump.file)
+	{
+		return;
+	}
+
+	fclose(entdump.file);
+	entdump.file = NULL;
+}
+
+/*
+ * Called by G_RunFrame(), writes the next
+ * few edicts of a running dump, so big maps
+ * don't stall a single frame.
+ */
+void
+G_DumpEntitiesFrame(void)
+{
+	edict_t *cur;
+	int i;
+
+	if (!entdump.file)
+	{
+		return;
+	}
+
+	/* the map changed under us */
+	if (strcmp(entdump.mapname, level.mapname) != 0)
+	{
+		gi.dprintf("Entity dump aborted by map change.\n");
+		G_DumpEntitiesStop();
+		return;
+	}
+
+	/* g_edicts, then the logic entities */
+	cur = G_EdictFrom(entdump.next);
+
+	for (i = 0; cur && (i < LISTENT_DUMPFRAME); i++, cur = G_NextEdict(cur))
+	{
+		if (EntityMatches(cur, &entdump.filter))
+		{
+			DumpEntity(cur);
+			entdump.written++;
+		}
+	}
+
+	if (cur)
+	{
+		entdump.next = G_NumForEdict(cur);
+	}
+	else
+	{
+		DumpWriteShort(-1);
+		DumpWriteLong(entdump.written);
+
+		gi.dprintf("Dumped %i entities.\n", entdump.written);
+		G_DumpEntitiesStop();
+	}
+}
+
+static void
+DumpEntitiesStart(edict_t *ent, const entfilter_t *filter)
+{
+	char name[MAX_OSPATH];
+	char mapname[MAX_QPATH];
+	cvar_t *game_dir;
+
+	if (entdump.file)
+	{
+		gi.cprintf(ent, PRINT_HIGH, "An entity dump is already running.\n");
+		return;
+	}
+
+	game_dir = gi.cvar("game", "", 0);
+	Com_sprintf(name, sizeof(name), "%s/entities-%s.bin",
+			*game_dir->string ? game_dir->string : GAMEVERSION, level.mapname);
+
+	if (!(entdump.file = Q_fopen(name, "wb")))
+	{
+		gi.cprintf(ent, PRINT_HIGH, "Couldn't open %s\n", name);
+		return;
+	}
+
+	entdump.filter = *filter;
+	Q_strlcpy(entdump.mapname, level.mapname, sizeof(entdump.mapname));
+	entdump.next = 0;
+	entdump.written = 0;
+
+	fwrite(LISTENT_MAGIC, 4, 1, entdump.file);
+	DumpWriteLong(LISTENT_VERSION);
+	DumpWriteLong(level.framenum);
+	memset(mapname, 0, sizeof(mapname));
+	Q_strlcpy(mapname, level.mapname, sizeof(mapname));
+	fwrite(mapname, sizeof(mapname), 1, entdump.file);
+
+	gi.cprintf(ent, PRINT_HIGH, "Dumping entities to %s.\n", name);
+}
+
 static void
 Cmd_ListEntities_f(edict_t *ent)
 {
+	entfilter_t filter;
+	qboolean dump = false;
+	char page[LISTENT_PAGE];
+	char line[256];
+	edict_t *cur;
+	int from = 0;
+	int i, count;
+
 	if ((deathmatch->value || coop->value) && !sv_cheats->value)
 	{
 		gi.cprintf(ent, PRINT_HIGH, "You must run the server with '+set cheats 1' to enable this command.\n");
@@ -1435,117 +1773,124 @@ Cmd_ListEntities_f(edict_t *ent)
 
 	if (gi.argc() < 2)
 	{
-		gi.cprintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
+		gi.cprintf(ent, PRINT_HIGH, "%s", listent_usage);
 		return;
 	}
 
-	/* What to print? */
-	qboolean all = false;
-	qboolean ammo = false;
-	qboolean items = false;
-	qboolean keys = false;
-	qboolean monsters = false;
-	qboolean weapons = false;
+	memset(&filter, 0, sizeof(filter));
+	filter.movetype = -1;
 
-	for (int i = 1; i < gi.argc(); i++)
+	/* What to print? */
+	for (i = 1; i < gi.argc(); i++)
 	{
 		const char *arg = gi.argv(i);
+		qboolean hasvalue = (i + 1 < gi.argc());
 
 		if (Q_stricmp(arg, "all") == 0)
 		{
-			all = true;
+			filter.categories |= LISTENT_ALL;
 		}
 		else if (Q_stricmp(arg, "ammo") == 0)
 		{
-			ammo = true;
+			filter.categories |= LISTENT_AMMO;
 		}
 		else if (Q_stricmp(arg, "items") == 0)
 		{
-			items = true;
+			filter.categories |= LISTENT_ITEMS;
 		}
 		else if (Q_stricmp(arg, "keys") == 0)
 		{
-			keys = true;
+			filter.categories |= LISTENT_KEYS;
 		}
 		else if (Q_stricmp(arg, "monsters") == 0)
 		{
-			monsters = true;
+			filter.categories |= LISTENT_MONSTERS;
 		}
 		else if (Q_stricmp(arg, "weapons") == 0)
 		{
-			weapons = true;
+			filter.categories |= LISTENT_WEAPONS;
 		}
-		else
+		else if (Q_stricmp(arg, "dump") == 0)
 		{
-			gi.cprintf(ent, PRINT_HIGH, "Usage: listentities <all|ammo|items|keys|monsters|weapons>\n");
+			dump = true;
 		}
-	}
-
-	/* Print what's requested. */
-	for (int i = 0; i < globals.num_edicts; i++)
-	{
-		edict_t *cur = &g_edicts[i];
-		qboolean print = false;
-
-		/* Ensure that the entity is valid. */
-		if (!cur->classname)
+		else if ((Q_stricmp(arg, "class") == 0) && hasvalue)
 		{
-			continue;
+			Q_strlcpy(filter.classname, gi.argv(++i), sizeof(filter.classname));
 		}
-
-		if (all)
+		else if ((Q_stricmp(arg, "radius") == 0) && hasvalue)
+		{
+			filter.radius = (float)atof(gi.argv(++i));
+			VectorCopy(ent->s.origin, filter.origin);
+		}
+		else if ((Q_stricmp(arg, "movetype") == 0) && hasvalue)
+		{
+			filter.movetype = atoi(gi.argv(++i));
+		}
+		else if ((Q_stricmp(arg, "svflags") == 0) && hasvalue)
+		{
+			filter.svflags = (int)strtol(gi.argv(++i), NULL, 0);
+		}
+		else if ((Q_stricmp(arg, "from") == 0) && hasvalue)
 		{
-			print = true;
+			from = atoi(gi.argv(++i));
 		}
 		else
 		{
-			if (ammo)
-			{
-				if (strncmp(cur->classname, "ammo_", 5) == 0)
-				{
-					print = true;
-				}
-			}
+			gi.cprintf(ent, PRINT_HIGH, "%s", listent_usage);
+			return;
+		}
+	}
 
-			if (items)
-			{
-				if (strncmp(cur->classname, "item_", 5) == 0)
-				{
-					print = true;
-				}
-			}
+	/* filters alone search everything */
+	if (!filter.categories)
+	{
+		filter.categories = LISTENT_ALL;
+	}
 
-			if (keys)
-			{
-				if (strncmp(cur->classname, "key_", 4) == 0)
-				{
-					print = true;
-				}
-			}
+	if (dump)
+	{
+		DumpEntitiesStart(ent, &filter);
+		return;
+	}
 
-			if (monsters)
-			{
-				if (strncmp(cur->classname, "monster_", 8) == 0)
-				{
-					print = true;
-				}
-			}
+	/* Print what's requested, a page at a time. */
+	page[0] = '\0';
+	count = 0;
 
-			if (weapons)
-			{
-				if (strncmp(cur->classname, "weapon_", 7) == 0)
-				{
-					print = true;
-				}
-			}
+	for (cur = G_EdictFrom(from); cur; cur = G_NextEdict(cur))
+	{
+		if (!EntityMatches(cur, &filter))
+		{
+			continue;
 		}
 
-		if (print)
+		Com_sprintf(line, sizeof(line), "%4i %s: %.0f %.0f %.0f\n",
+				G_NumForEdict(cur), cur->classname, cur->s.origin[0], cur->s.origin[1],
+				cur->s.origin[2]);
+
+		if (strlen(page) + strlen(line) >= sizeof(page) - 32)
 		{
-			/* We use dprintf() because cprintf() may flood the server... */
-			gi.dprintf("%s: %f %f %f\n", cur->classname, cur->s.origin[0], cur->s.origin[1], cur->s.origin[2]);
+			break;
 		}
+
+		Q_strlcat(page, line, sizeof(page));
+		count++;
+	}
+
+	if (cur)
+	{
+		Com_sprintf(line, sizeof(line), "%i shown, more with \"from %i\"\n",
+				count, G_NumForEdict(cur));
 	}
+	else
+	{
+		Com_sprintf(line, sizeof(line), "%i shown, end of list\n", count);
+	}
+
+	Q_strlcat(page, line, sizeof(page));
+
+	gi.cprintf(ent, PRINT_HIGH, "%s", page);
 }
 
 static int
@@ -1818,6 +2163,105 @@ Cmd_PrefWeap_f(edict_t *ent)
 	}
 }
 
+/*
+ * What a command costs from the rate limit
+ * bucket. Anything not listed costs 1.
+ */
+static const struct
+{
+	const char *name;
+	int cost;
+} cmd_costs[] = {
+	{"players", 4}, /* sorts all clients */
+	{"playerlist", 4},
+	{"score", 2},
+	{"help", 2},
+	{"inven", 2},
+	{"wave", 2},
+	{"kill", 2},
+	{"spawnentity", 5},
+	{"spawnonstart", 5},
+	{"listentities", 10}, /* walks all edicts */
+	{NULL, 0}
+};
+
+/*
+ * Token bucket rate limit for client commands,
+ * refilled with cmd_rate tokens per second up
+ * to cmd_burst. Returns false if the command
+ * should be dropped.
+ */
+static qboolean
+CommandAllowed(edict_t *ent, const char *cmd)
+{
+	client_respawn_t *resp;
+	float cost, burst;
+	int i;
+
+	resp = &ent->client->resp;
+	resp->cmd_count++;
+
+	if (!deathmatch->value && !coop->value)
+	{
+		return true;
+	}
+
+	if ((cmd_rate->value <= 0) || (cmd_burst->value <= 0))
+	{
+		return true;
+	}
+
+	burst = cmd_burst->value;
+
+	/* level.time starts over on a new map */
+	if (resp->cmd_tokentime > level.time)
+	{
+		resp->cmd_tokentime = level.time;
+		resp->cmd_warntime = 0;
+	}
+
+	resp->cmd_tokens += (level.time - resp->cmd_tokentime) * cmd_rate->value;
+	resp->cmd_tokentime = level.time;
+
+	if (resp->cmd_tokens > burst)
+	{
+		resp->cmd_tokens = burst;
+	}
+
+	cost = 1;
+
+	for (i = 0; cmd_costs[i].name; i++)
+	{
+		if (Q_stricmp(cmd, cmd_costs[i].name) == 0)
+		{
+			cost = cmd_costs[i].cost;
+			break;
+		}
+	}
+
+	/* a cost above the burst would never pass */
+	if (cost > burst)
+	{
+		cost = burst;
+	}
+
+	if (resp->cmd_tokens >= cost)
+	{
+		resp->cmd_tokens -= cost;
+		return true;
+	}
+
+	resp->cmd_dropped++;
+
+	if (level.time >= resp->cmd_warntime)
+	{
+		resp->cmd_warntime = level.time + 1;
+		gi.cprintf(ent, PRINT_HIGH, "Too many commands, %s ignored.\n", cmd);
+	}
+
+	return false;
+}
+
 void
 ClientCommand(edict_t *ent)
 {
@@ -1833,8 +2277,14 @@ ClientCommand(edict_t *ent)
 		return; /* not fully in game yet */
 	}
 
+	G_NetStatsSource(ent);
 	cmd = gi.argv(0);
 
+	if (!CommandAllowed(ent, cmd))
+	{
+		return;
+	}
+
 	if (Q_stricmp(cmd, "players") == 0)
 	{
 		Cmd_Players_f(ent);
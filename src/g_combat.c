@@ -131,7 +131,7 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 
 	if ((targ->svflags & SVF_MONSTER) && (targ->deadflag != DEAD_DEAD))
 	{
-		if (!(targ->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (!(targ->monsterinfo->aiflags & AI_GOOD_GUY))
 		{
 			level.killed_monsters++;
 
@@ -141,7 +141,7 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 			}
 
 			/* medics won't heal monsters that they kill themselves */
-			if (attacker->classname && strcmp(attacker->classname, "monster_medic") == 0)
+			if (G_ClassAtom(attacker) == CN_monster_medic)
 			{
 				targ->owner = attacker;
 			}
@@ -169,6 +169,11 @@ Killed(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 void
 SpawnDamage(int type, vec3_t origin, vec3_t normal)
 {
+	if (!G_EffectVisible(origin, MULTICAST_PVS, EFFECT_POINTDIR))
+	{
+		return;
+	}
+
 	gi.WriteByte(svc_temp_entity);
 	gi.WriteByte(type);
 	gi.WritePosition(origin);
@@ -235,14 +240,14 @@ CheckPowerArmor(edict_t *ent, vec3_t point, vec3_t normal, int damage,
 
 		if (power_armor_type != POWER_ARMOR_NONE)
 		{
-			index = ITEM_INDEX(FindItem("Cells"));
+			index = cells_index;
 			power = client->pers.inventory[index];
 		}
 	}
 	else if (ent->svflags & SVF_MONSTER)
 	{
-		power_armor_type = ent->monsterinfo.power_armor_type;
-		power = ent->monsterinfo.power_armor_power;
+		power_armor_type = ent->monsterinfo->power_armor_type;
+		power = ent->monsterinfo->power_armor_power;
 		index = 0;
 	}
 	else
@@ -311,7 +316,7 @@ CheckPowerArmor(edict_t *ent, vec3_t point, vec3_t normal, int damage,
 	}
 	else
 	{
-		ent->monsterinfo.power_armor_power -= power_used;
+		ent->monsterinfo->power_armor_power -= power_used;
 	}
 
 	return save;
@@ -407,9 +412,10 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 	/* if we are a good guy monster and our attacker is a player
 	   or another good guy, do not get mad at them */
-	if (targ->monsterinfo.aiflags & AI_GOOD_GUY)
+	if (targ->monsterinfo->aiflags & AI_GOOD_GUY)
 	{
-		if (attacker->client || (attacker->monsterinfo.aiflags & AI_GOOD_GUY))
+		if (attacker->client || (attacker->monsterinfo &&
+			(attacker->monsterinfo->aiflags & AI_GOOD_GUY)))
 		{
 			return;
 		}
@@ -419,7 +425,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 	   them because he's good and we're not */
 	if (attacker->client)
 	{
-		targ->monsterinfo.aiflags &= ~AI_SOUND_TARGET;
+		targ->monsterinfo->aiflags &= ~AI_SOUND_TARGET;
 
 		/* this can only happen in coop (both new and old
 		   enemies are clients)  only switch if can't see
@@ -437,7 +443,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -450,11 +456,11 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 	   (they spray too much), get mad at them */
 	if (((targ->flags & (FL_FLY | FL_SWIM)) ==
 		 (attacker->flags & (FL_FLY | FL_SWIM))) &&
-		(strcmp(targ->classname, attacker->classname) != 0) &&
-		(strcmp(attacker->classname, "monster_tank") != 0) &&
-		(strcmp(attacker->classname, "monster_supertank") != 0) &&
-		(strcmp(attacker->classname, "monster_makron") != 0) &&
-		(strcmp(attacker->classname, "monster_jorg") != 0))
+		(G_ClassAtom(targ) != G_ClassAtom(attacker)) &&
+		(G_ClassAtom(attacker) != CN_monster_tank) &&
+		(G_ClassAtom(attacker) != CN_monster_supertank) &&
+		(G_ClassAtom(attacker) != CN_monster_makron) &&
+		(G_ClassAtom(attacker) != CN_monster_jorg))
 	{
 		if (targ->enemy && targ->enemy->client)
 		{
@@ -463,7 +469,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -478,7 +484,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -494,7 +500,7 @@ M_ReactToDamage(edict_t *targ, edict_t *attacker)
 
 		targ->enemy = attacker->enemy;
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED))
 		{
 			FoundTarget(targ);
 		}
@@ -673,7 +679,7 @@ T_Damage(edict_t *targ, edict_t *inflictor, edict_t *attacker,
 	{
 		M_ReactToDamage(targ, attacker);
 
-		if (!(targ->monsterinfo.aiflags & AI_DUCKED) && (take))
+		if (!(targ->monsterinfo->aiflags & AI_DUCKED) && (take))
 		{
 			targ->pain(targ, attacker, knockback, take);
 
@@ -89,7 +89,7 @@ Move_Done(edict_t *ent)
 	}
 
 	VectorClear(ent->velocity);
-	ent->moveinfo.endfunc(ent);
+	ent->moveinfo->endfunc(ent);
 }
 
 void
@@ -100,14 +100,14 @@ Move_Final(edict_t *ent)
 		return;
 	}
 
-	if (ent->moveinfo.remaining_distance == 0)
+	if (ent->moveinfo->remaining_distance == 0)
 	{
 		Move_Done(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir,
-			ent->moveinfo.remaining_distance / FRAMETIME,
+	VectorScale(ent->moveinfo->dir,
+			ent->moveinfo->remaining_distance / FRAMETIME,
 			ent->velocity);
 
 	ent->think = Move_Done;
@@ -124,17 +124,17 @@ Move_Begin(edict_t *ent)
 		return;
 	}
 
-	if ((ent->moveinfo.speed * FRAMETIME) >= ent->moveinfo.remaining_distance)
+	if ((ent->moveinfo->speed * FRAMETIME) >= ent->moveinfo->remaining_distance)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir, ent->moveinfo.speed, ent->velocity);
+	VectorScale(ent->moveinfo->dir, ent->moveinfo->speed, ent->velocity);
 	frames = floor(
-			(ent->moveinfo.remaining_distance /
-			 ent->moveinfo.speed) / FRAMETIME);
-	ent->moveinfo.remaining_distance -= frames * ent->moveinfo.speed *
+			(ent->moveinfo->remaining_distance /
+			 ent->moveinfo->speed) / FRAMETIME);
+	ent->moveinfo->remaining_distance -= frames * ent->moveinfo->speed *
 										FRAMETIME;
 	ent->nextthink = level.time + (frames * FRAMETIME);
 	ent->think = Move_Final;
@@ -149,12 +149,12 @@ Move_Calc(edict_t *ent, vec3_t dest, void (*func)(edict_t *))
 	}
 
 	VectorClear(ent->velocity);
-	VectorSubtract(dest, ent->s.origin, ent->moveinfo.dir);
-	ent->moveinfo.remaining_distance = VectorNormalize(ent->moveinfo.dir);
-	ent->moveinfo.endfunc = func;
+	VectorSubtract(dest, ent->s.origin, ent->moveinfo->dir);
+	ent->moveinfo->remaining_distance = VectorNormalize(ent->moveinfo->dir);
+	ent->moveinfo->endfunc = func;
 
-	if ((ent->moveinfo.speed == ent->moveinfo.accel) &&
-		(ent->moveinfo.speed == ent->moveinfo.decel))
+	if ((ent->moveinfo->speed == ent->moveinfo->accel) &&
+		(ent->moveinfo->speed == ent->moveinfo->decel))
 	{
 		if (level.current_entity ==
 			((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
@@ -170,7 +170,7 @@ Move_Calc(edict_t *ent, vec3_t dest, void (*func)(edict_t *))
 	else
 	{
 		/* accelerative */
-		ent->moveinfo.current_speed = 0;
+		ent->moveinfo->current_speed = 0;
 		ent->think = Think_AccelMove;
 		ent->nextthink = level.time + FRAMETIME;
 	}
@@ -187,7 +187,7 @@ AngleMove_Done(edict_t *ent)
 	}
 
 	VectorClear(ent->avelocity);
-	ent->moveinfo.endfunc(ent);
+	ent->moveinfo->endfunc(ent);
 }
 
 void
@@ -200,13 +200,13 @@ AngleMove_Final(edict_t *ent)
 		return;
 	}
 
-	if (ent->moveinfo.state == STATE_UP)
+	if (ent->moveinfo->state == STATE_UP)
 	{
-		VectorSubtract(ent->moveinfo.end_angles, ent->s.angles, move);
+		VectorSubtract(ent->moveinfo->end_angles, ent->s.angles, move);
 	}
 	else
 	{
-		VectorSubtract(ent->moveinfo.start_angles, ent->s.angles, move);
+		VectorSubtract(ent->moveinfo->start_angles, ent->s.angles, move);
 	}
 
 	if (VectorCompare(move, vec3_origin))
@@ -235,20 +235,20 @@ AngleMove_Begin(edict_t *ent)
 	}
 
 	/* set destdelta to the vector needed to move */
-	if (ent->moveinfo.state == STATE_UP)
+	if (ent->moveinfo->state == STATE_UP)
 	{
-		VectorSubtract(ent->moveinfo.end_angles, ent->s.angles, destdelta);
+		VectorSubtract(ent->moveinfo->end_angles, ent->s.angles, destdelta);
 	}
 	else
 	{
-		VectorSubtract(ent->moveinfo.start_angles, ent->s.angles, destdelta);
+		VectorSubtract(ent->moveinfo->start_angles, ent->s.angles, destdelta);
 	}
 
 	/* calculate length of vector */
 	len = VectorLength(destdelta);
 
 	/* divide by speed to get time to reach dest */
-	traveltime = len / ent->moveinfo.speed;
+	traveltime = len / ent->moveinfo->speed;
 
 	if (traveltime < FRAMETIME)
 	{
@@ -275,7 +275,7 @@ AngleMove_Calc(edict_t *ent, void (*func)(edict_t *))
 	}
 
 	VectorClear(ent->avelocity);
-	ent->moveinfo.endfunc = func;
+	ent->moveinfo->endfunc = func;
 
 	if (level.current_entity ==
 		((ent->flags & FL_TEAMSLAVE) ? ent->teammaster : ent))
@@ -438,23 +438,23 @@ Think_AccelMove(edict_t *ent)
 		return;
 	}
 
-	ent->moveinfo.remaining_distance -= ent->moveinfo.current_speed;
+	ent->moveinfo->remaining_distance -= ent->moveinfo->current_speed;
 
-	if (ent->moveinfo.current_speed == 0) /* starting or blocked */
+	if (ent->moveinfo->current_speed == 0) /* starting or blocked */
 	{
-		plat_CalcAcceleratedMove(&ent->moveinfo);
+		plat_CalcAcceleratedMove(ent->moveinfo);
 	}
 
-	plat_Accelerate(&ent->moveinfo);
+	plat_Accelerate(ent->moveinfo);
 
 	/* will the entire move complete on next frame? */
-	if (ent->moveinfo.remaining_distance <= ent->moveinfo.current_speed)
+	if (ent->moveinfo->remaining_distance <= ent->moveinfo->current_speed)
 	{
 		Move_Final(ent);
 		return;
 	}
 
-	VectorScale(ent->moveinfo.dir, ent->moveinfo.current_speed * 10,
+	VectorScale(ent->moveinfo->dir, ent->moveinfo->current_speed * 10,
 			ent->velocity);
 	ent->nextthink = level.time + FRAMETIME;
 	ent->think = Think_AccelMove;
@@ -470,16 +470,16 @@ plat_hit_top(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
+		if (ent->moveinfo->sound_end)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+					ent->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		}
 
 		ent->s.sound = 0;
 	}
 
-	ent->moveinfo.state = STATE_TOP;
+	ent->moveinfo->state = STATE_TOP;
 
 	ent->think = plat_go_down;
 	ent->nextthink = level.time + 3;
@@ -495,16 +495,16 @@ plat_hit_bottom(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_end)
+		if (ent->moveinfo->sound_end)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_end, 1, ATTN_STATIC, 0);
+					ent->moveinfo->sound_end, 1, ATTN_STATIC, 0);
 		}
 
 		ent->s.sound = 0;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 }
 
 void
@@ -517,17 +517,17 @@ plat_go_down(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
+		if (ent->moveinfo->sound_start)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_start, 1, ATTN_STATIC, 0);
+					ent->moveinfo->sound_start, 1, ATTN_STATIC, 0);
 		}
 
-		ent->s.sound = ent->moveinfo.sound_middle;
+		ent->s.sound = ent->moveinfo->sound_middle;
 	}
 
-	ent->moveinfo.state = STATE_DOWN;
-	Move_Calc(ent, ent->moveinfo.end_origin, plat_hit_bottom);
+	ent->moveinfo->state = STATE_DOWN;
+	Move_Calc(ent, ent->moveinfo->end_origin, plat_hit_bottom);
 }
 
 void
@@ -540,17 +540,17 @@ plat_go_up(edict_t *ent)
 
 	if (!(ent->flags & FL_TEAMSLAVE))
 	{
-		if (ent->moveinfo.sound_start)
+		if (ent->moveinfo->sound_start)
 		{
 			gi.sound(ent, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					ent->moveinfo.sound_start, 1, ATTN_STATIC, 0);
+					ent->moveinfo->sound_start, 1, ATTN_STATIC, 0);
 		}
 
-		ent->s.sound = ent->moveinfo.sound_middle;
+		ent->s.sound = ent->moveinfo->sound_middle;
 	}
 
-	ent->moveinfo.state = STATE_UP;
-	Move_Calc(ent, ent->moveinfo.start_origin, plat_hit_top);
+	ent->moveinfo->state = STATE_UP;
+	Move_Calc(ent, ent->moveinfo->start_origin, plat_hit_top);
 }
 
 void
@@ -581,11 +581,11 @@ plat_blocked(edict_t *self, edict_t *other)
 	T_Damage(other, self, self, vec3_origin, other->s.origin,
 			vec3_origin, self->dmg, 1, 0, MOD_CRUSH);
 
-	if (self->moveinfo.state == STATE_UP)
+	if (self->moveinfo->state == STATE_UP)
 	{
 		plat_go_down(self);
 	}
-	else if (self->moveinfo.state == STATE_DOWN)
+	else if (self->moveinfo->state == STATE_DOWN)
 	{
 		plat_go_up(self);
 	}
@@ -610,8 +610,8 @@ Use_Plat(edict_t *ent, edict_t *other /* unused */, edict_t *activator /* unused
 void
 wait_and_change_think(edict_t* ent)
 {
-	void (*afterwaitfunc)(edict_t *) = ent->moveinfo.endfunc;
-	ent->moveinfo.endfunc = NULL;
+	void (*afterwaitfunc)(edict_t *) = ent->moveinfo->endfunc;
+	ent->moveinfo->endfunc = NULL;
 	afterwaitfunc(ent);
 }
 
@@ -628,7 +628,7 @@ wait_and_change(edict_t* ent, void (*afterwaitfunc)(edict_t *))
 	{
 		if(ent->nextthink == 0)
 		{
-			ent->moveinfo.endfunc = afterwaitfunc;
+			ent->moveinfo->endfunc = afterwaitfunc;
 			ent->think = wait_and_change_think;
 			ent->nextthink = level.time + waittime;
 		}
@@ -660,11 +660,11 @@ Touch_Plat_Center(edict_t *ent, edict_t *other, cplane_t *plane /* unused */,
 
 	ent = ent->enemy; /* now point at the plat, not the trigger */
 
-	if (ent->moveinfo.state == STATE_BOTTOM)
+	if (ent->moveinfo->state == STATE_BOTTOM)
 	{
 		wait_and_change(ent, plat_go_up);
 	}
-	else if (ent->moveinfo.state == STATE_TOP)
+	else if (ent->moveinfo->state == STATE_TOP)
 	{
 		/* the player is still on the plat, so delay going down */
 		ent->nextthink = level.time + 1;
@@ -754,6 +754,8 @@ SP_func_plat(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	VectorClear(ent->s.angles);
 	ent->solid = SOLID_BSP;
 	ent->movetype = MOVETYPE_PUSH;
@@ -818,27 +820,27 @@ SP_func_plat(edict_t *ent)
 
 	if (ent->targetname)
 	{
-		ent->moveinfo.state = STATE_UP;
+		ent->moveinfo->state = STATE_UP;
 	}
 	else
 	{
 		VectorCopy(ent->pos2, ent->s.origin);
 		gi.linkentity(ent);
-		ent->moveinfo.state = STATE_BOTTOM;
+		ent->moveinfo->state = STATE_BOTTOM;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->end_angles);
 
-	ent->moveinfo.sound_start = gi.soundindex("plats/pt1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("plats/pt1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("plats/pt1_end.wav");
+	ent->moveinfo->sound_start = gi.soundindex("plats/pt1_strt.wav");
+	ent->moveinfo->sound_middle = gi.soundindex("plats/pt1_mid.wav");
+	ent->moveinfo->sound_end = gi.soundindex("plats/pt1_end.wav");
 }
 
 /* ==================================================================== */
@@ -901,7 +903,7 @@ rotating_use(edict_t *self, edict_t *other /* unused */, edict_t *activator /* u
 	}
 	else
 	{
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = self->moveinfo->sound_middle;
 		VectorScale(self->movedir, self->speed, self->avelocity);
 
 		if (self->spawnflags & 16)
@@ -919,6 +921,8 @@ SP_func_rotating(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	ent->solid = SOLID_BSP;
 
 	if (ent->spawnflags & 32)
@@ -1017,7 +1021,7 @@ button_done(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 	self->s.effects &= ~EF_ANIM23;
 	self->s.effects |= EF_ANIM01;
 }
@@ -1030,9 +1034,9 @@ button_return(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_DOWN;
+	self->moveinfo->state = STATE_DOWN;
 
-	Move_Calc(self, self->moveinfo.start_origin, button_done);
+	Move_Calc(self, self->moveinfo->start_origin, button_done);
 
 	self->s.frame = 0;
 
@@ -1050,16 +1054,16 @@ button_wait(edict_t *self)
 		return;
 	}
 
-	self->moveinfo.state = STATE_TOP;
+	self->moveinfo->state = STATE_TOP;
 	self->s.effects &= ~EF_ANIM01;
 	self->s.effects |= EF_ANIM23;
 
 	G_UseTargets(self, self->activator);
 	self->s.frame = 1;
 
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
-		self->nextthink = level.time + self->moveinfo.wait;
+		self->nextthink = level.time + self->moveinfo->wait;
 		self->think = button_return;
 	}
 }
@@ -1072,22 +1076,22 @@ button_fire(edict_t *self)
 		return;
 	}
 
-	if ((self->moveinfo.state == STATE_UP) ||
-		(self->moveinfo.state == STATE_TOP))
+	if ((self->moveinfo->state == STATE_UP) ||
+		(self->moveinfo->state == STATE_TOP))
 	{
 		return;
 	}
 
-	self->moveinfo.state = STATE_UP;
+	self->moveinfo->state = STATE_UP;
 
-	if (self->moveinfo.sound_start && !(self->flags & FL_TEAMSLAVE))
+	if (self->moveinfo->sound_start && !(self->flags & FL_TEAMSLAVE))
 	{
 		gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-				self->moveinfo.sound_start, 1, ATTN_STATIC,
+				self->moveinfo->sound_start, 1, ATTN_STATIC,
 				0);
 	}
 
-	Move_Calc(self, self->moveinfo.end_origin, button_wait);
+	Move_Calc(self, self->moveinfo->end_origin, button_wait);
 }
 
 void
@@ -1150,6 +1154,8 @@ SP_func_button(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	G_SetMovedir(ent->s.angles, ent->movedir);
 	ent->movetype = MOVETYPE_STOP;
 	ent->solid = SOLID_BSP;
@@ -1157,7 +1163,7 @@ SP_func_button(edict_t *ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("switches/butn2.wav");
+		ent->moveinfo->sound_start = gi.soundindex("switches/butn2.wav");
 	}
 
 	if (!ent->speed)
@@ -1207,16 +1213,16 @@ SP_func_button(edict_t *ent)
 		ent->touch = button_touch;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->end_angles);
 
 	gi.linkentity(ent);
 }
@@ -1273,7 +1279,7 @@ door_use_areaportals(edict_t *self, qboolean open)
 
 	while ((t = G_Find(t, FOFS(targetname), self->target)))
 	{
-		if (Q_stricmp(t->classname, "func_areaportal") == 0)
+		if (G_ClassAtom(t) == CN_func_areaportal)
 		{
 			gi.SetAreaPortalState(t->style, open);
 		}
@@ -1290,26 +1296,26 @@ door_hit_top(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
+		if (self->moveinfo->sound_end)
 		{
-			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo.sound_end,
+			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE, self->moveinfo->sound_end,
 					1, ATTN_STATIC, 0);
 		}
 
 		self->s.sound = 0;
 	}
 
-	self->moveinfo.state = STATE_TOP;
+	self->moveinfo->state = STATE_TOP;
 
 	if (self->spawnflags & DOOR_TOGGLE)
 	{
 		return;
 	}
 
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
 		self->think = door_go_down;
-		self->nextthink = level.time + self->moveinfo.wait;
+		self->nextthink = level.time + self->moveinfo->wait;
 	}
 }
 
@@ -1323,17 +1329,17 @@ door_hit_bottom(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_end)
+		if (self->moveinfo->sound_end)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_end, 1,
+					self->moveinfo->sound_end, 1,
 					ATTN_STATIC, 0);
 		}
 
 		self->s.sound = 0;
 	}
 
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 	door_use_areaportals(self, false);
 }
 
@@ -1347,14 +1353,14 @@ door_go_down(edict_t *self)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (self->moveinfo->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					self->moveinfo->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = self->moveinfo->sound_middle;
 	}
 
 	if (self->max_health)
@@ -1363,13 +1369,13 @@ door_go_down(edict_t *self)
 		self->health = self->max_health;
 	}
 
-	self->moveinfo.state = STATE_DOWN;
+	self->moveinfo->state = STATE_DOWN;
 
-	if (strcmp(self->classname, "func_door") == 0)
+	if (G_ClassAtom(self) == CN_func_door)
 	{
-		Move_Calc(self, self->moveinfo.start_origin, door_hit_bottom);
+		Move_Calc(self, self->moveinfo->start_origin, door_hit_bottom);
 	}
-	else if (strcmp(self->classname, "func_door_rotating") == 0)
+	else if (G_ClassAtom(self) == CN_func_door_rotating)
 	{
 		AngleMove_Calc(self, door_hit_bottom);
 	}
@@ -1383,17 +1389,17 @@ door_go_up(edict_t *self, edict_t *activator)
 		return;
 	}
 
-	if (self->moveinfo.state == STATE_UP)
+	if (self->moveinfo->state == STATE_UP)
 	{
 		return; /* already going up */
 	}
 
-	if (self->moveinfo.state == STATE_TOP)
+	if (self->moveinfo->state == STATE_TOP)
 	{
 		/* reset top wait time */
-		if (self->moveinfo.wait >= 0)
+		if (self->moveinfo->wait >= 0)
 		{
-			self->nextthink = level.time + self->moveinfo.wait;
+			self->nextthink = level.time + self->moveinfo->wait;
 		}
 
 		return;
@@ -1401,23 +1407,23 @@ door_go_up(edict_t *self, edict_t *activator)
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (self->moveinfo->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					self->moveinfo->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = self->moveinfo->sound_middle;
 	}
 
-	self->moveinfo.state = STATE_UP;
+	self->moveinfo->state = STATE_UP;
 
-	if (strcmp(self->classname, "func_door") == 0)
+	if (G_ClassAtom(self) == CN_func_door)
 	{
-		Move_Calc(self, self->moveinfo.end_origin, door_hit_top);
+		Move_Calc(self, self->moveinfo->end_origin, door_hit_top);
 	}
-	else if (strcmp(self->classname, "func_door_rotating") == 0)
+	else if (G_ClassAtom(self) == CN_func_door_rotating)
 	{
 		AngleMove_Calc(self, door_hit_top);
 	}
@@ -1443,8 +1449,8 @@ door_use(edict_t *self, edict_t *other /* unused */, edict_t *activator)
 
 	if (self->spawnflags & DOOR_TOGGLE)
 	{
-		if ((self->moveinfo.state == STATE_UP) ||
-			(self->moveinfo.state == STATE_TOP))
+		if ((self->moveinfo->state == STATE_UP) ||
+			(self->moveinfo->state == STATE_TOP))
 		{
 			/* trigger all paired doors */
 			for (ent = self; ent; ent = ent->teamchain)
@@ -1523,11 +1529,11 @@ Think_CalcMoveSpeed(edict_t *self)
 	}
 
 	/* find the smallest distance any member of the team will be moving */
-	min = fabs(self->moveinfo.distance);
+	min = fabs(self->moveinfo->distance);
 
 	for (ent = self->teamchain; ent; ent = ent->teamchain)
 	{
-		dist = fabs(ent->moveinfo.distance);
+		dist = fabs(ent->moveinfo->distance);
 
 		if (dist < min)
 		{
@@ -1535,33 +1541,33 @@ Think_CalcMoveSpeed(edict_t *self)
 		}
 	}
 
-	time = min / self->moveinfo.speed;
+	time = min / self->moveinfo->speed;
 
 	/* adjust speeds so they will all complete at the same time */
 	for (ent = self; ent; ent = ent->teamchain)
 	{
-		newspeed = fabs(ent->moveinfo.distance) / time;
-		ratio = newspeed / ent->moveinfo.speed;
+		newspeed = fabs(ent->moveinfo->distance) / time;
+		ratio = newspeed / ent->moveinfo->speed;
 
-		if (ent->moveinfo.accel == ent->moveinfo.speed)
+		if (ent->moveinfo->accel == ent->moveinfo->speed)
 		{
-			ent->moveinfo.accel = newspeed;
+			ent->moveinfo->accel = newspeed;
 		}
 		else
 		{
-			ent->moveinfo.accel *= ratio;
+			ent->moveinfo->accel *= ratio;
 		}
 
-		if (ent->moveinfo.decel == ent->moveinfo.speed)
+		if (ent->moveinfo->decel == ent->moveinfo->speed)
 		{
-			ent->moveinfo.decel = newspeed;
+			ent->moveinfo->decel = newspeed;
 		}
 		else
 		{
-			ent->moveinfo.decel *= ratio;
+			ent->moveinfo->decel *= ratio;
 		}
 
-		ent->moveinfo.speed = newspeed;
+		ent->moveinfo->speed = newspeed;
 	}
 }
 
@@ -1650,9 +1656,9 @@ door_blocked(edict_t *self, edict_t *other)
 
 	/* if a door has a negative wait, it would never come back if blocked,
 	   so let it just squash the object to death real fast */
-	if (self->moveinfo.wait >= 0)
+	if (self->moveinfo->wait >= 0)
 	{
-		if (self->moveinfo.state == STATE_DOWN)
+		if (self->moveinfo->state == STATE_DOWN)
 		{
 			for (ent = self->teammaster; ent; ent = ent->teamchain)
 			{
@@ -1723,11 +1729,13 @@ SP_func_door(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	G_SetMovedir(ent->s.angles, ent->movedir);
@@ -1778,10 +1786,10 @@ SP_func_door(edict_t *ent)
 	abs_movedir[0] = fabs(ent->movedir[0]);
 	abs_movedir[1] = fabs(ent->movedir[1]);
 	abs_movedir[2] = fabs(ent->movedir[2]);
-	ent->moveinfo.distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] *
+	ent->moveinfo->distance = abs_movedir[0] * ent->size[0] + abs_movedir[1] *
 							 ent->size[1] + abs_movedir[2] * ent->size[2] -
 							 st.lip;
-	VectorMA(ent->pos1, ent->moveinfo.distance, ent->movedir, ent->pos2);
+	VectorMA(ent->pos1, ent->moveinfo->distance, ent->movedir, ent->pos2);
 
 	/* if it starts open, switch the positions */
 	if (ent->spawnflags & DOOR_START_OPEN)
@@ -1791,7 +1799,7 @@ SP_func_door(edict_t *ent)
 		VectorCopy(ent->s.origin, ent->pos1);
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
+	ent->moveinfo->state = STATE_BOTTOM;
 
 	if (ent->health)
 	{
@@ -1805,14 +1813,14 @@ SP_func_door(edict_t *ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->pos1, ent->moveinfo.start_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.start_angles);
-	VectorCopy(ent->pos2, ent->moveinfo.end_origin);
-	VectorCopy(ent->s.angles, ent->moveinfo.end_angles);
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy(ent->pos1, ent->moveinfo->start_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->start_angles);
+	VectorCopy(ent->pos2, ent->moveinfo->end_origin);
+	VectorCopy(ent->s.angles, ent->moveinfo->end_angles);
 
 	if (ent->spawnflags & 16)
 	{
@@ -1884,6 +1892,8 @@ SP_func_door_rotating(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	VectorClear(ent->s.angles);
 
 	/* set the axis of rotation */
@@ -1917,7 +1927,7 @@ SP_func_door_rotating(edict_t *ent)
 
 	VectorCopy(ent->s.angles, ent->pos1);
 	VectorMA(ent->s.angles, st.distance, ent->movedir, ent->pos2);
-	ent->moveinfo.distance = st.distance;
+	ent->moveinfo->distance = st.distance;
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -1953,9 +1963,9 @@ SP_func_door_rotating(edict_t *ent)
 
 	if (ent->sounds != 1)
 	{
-		ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-		ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-		ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+		ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+		ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+		ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 	}
 
 	/* if it starts open, switch the positions */
@@ -1980,15 +1990,15 @@ SP_func_door_rotating(edict_t *ent)
 		ent->touch = door_touch;
 	}
 
-	ent->moveinfo.state = STATE_BOTTOM;
-	ent->moveinfo.speed = ent->speed;
-	ent->moveinfo.accel = ent->accel;
-	ent->moveinfo.decel = ent->decel;
-	ent->moveinfo.wait = ent->wait;
-	VectorCopy(ent->s.origin, ent->moveinfo.start_origin);
-	VectorCopy(ent->pos1, ent->moveinfo.start_angles);
-	VectorCopy(ent->s.origin, ent->moveinfo.end_origin);
-	VectorCopy(ent->pos2, ent->moveinfo.end_angles);
+	ent->moveinfo->state = STATE_BOTTOM;
+	ent->moveinfo->speed = ent->speed;
+	ent->moveinfo->accel = ent->accel;
+	ent->moveinfo->decel = ent->decel;
+	ent->moveinfo->wait = ent->wait;
+	VectorCopy(ent->s.origin, ent->moveinfo->start_origin);
+	VectorCopy(ent->pos1, ent->moveinfo->start_angles);
+	VectorCopy(ent->s.origin, ent->moveinfo->end_origin);
+	VectorCopy(ent->pos2, ent->moveinfo->end_angles);
 
 	if (ent->spawnflags & 16)
 	{
@@ -2045,6 +2055,8 @@ SP_func_water(edict_t *self)
 		return;
 	}
 
+	G_AllocMoveInfo(self);
+
 	G_SetMovedir(self->s.angles, self->movedir);
 	self->movetype = MOVETYPE_PUSH;
 	self->solid = SOLID_BSP;
@@ -2057,8 +2069,8 @@ SP_func_water(edict_t *self)
 
 		case 1: /* water */
 		case 2: /* lava */
-			self->moveinfo.sound_start = gi.soundindex("world/mov_watr.wav");
-			self->moveinfo.sound_end = gi.soundindex("world/stp_watr.wav");
+			self->moveinfo->sound_start = gi.soundindex("world/mov_watr.wav");
+			self->moveinfo->sound_end = gi.soundindex("world/stp_watr.wav");
 			break;
 	}
 
@@ -2067,10 +2079,10 @@ SP_func_water(edict_t *self)
 	abs_movedir[0] = fabs(self->movedir[0]);
 	abs_movedir[1] = fabs(self->movedir[1]);
 	abs_movedir[2] = fabs(self->movedir[2]);
-	self->moveinfo.distance = abs_movedir[0] * self->size[0] + abs_movedir[1] *
+	self->moveinfo->distance = abs_movedir[0] * self->size[0] + abs_movedir[1] *
 							  self->size[1] + abs_movedir[2] * self->size[2] -
 							  st.lip;
-	VectorMA(self->pos1, self->moveinfo.distance, self->movedir, self->pos2);
+	VectorMA(self->pos1, self->moveinfo->distance, self->movedir, self->pos2);
 
 	/* if it starts open, switch the positions */
 	if (self->spawnflags & DOOR_START_OPEN)
@@ -2080,27 +2092,27 @@ SP_func_water(edict_t *self)
 		VectorCopy(self->s.origin, self->pos1);
 	}
 
-	VectorCopy(self->pos1, self->moveinfo.start_origin);
-	VectorCopy(self->s.angles, self->moveinfo.start_angles);
-	VectorCopy(self->pos2, self->moveinfo.end_origin);
-	VectorCopy(self->s.angles, self->moveinfo.end_angles);
+	VectorCopy(self->pos1, self->moveinfo->start_origin);
+	VectorCopy(self->s.angles, self->moveinfo->start_angles);
+	VectorCopy(self->pos2, self->moveinfo->end_origin);
+	VectorCopy(self->s.angles, self->moveinfo->end_angles);
 
-	self->moveinfo.state = STATE_BOTTOM;
+	self->moveinfo->state = STATE_BOTTOM;
 
 	if (!self->speed)
 	{
 		self->speed = 25;
 	}
 
-	self->moveinfo.accel = self->moveinfo.decel =
-	   	self->moveinfo.speed = self->speed;
+	self->moveinfo->accel = self->moveinfo->decel =
+	   	self->moveinfo->speed = self->speed;
 
 	if (!self->wait)
 	{
 		self->wait = -1;
 	}
 
-	self->moveinfo.wait = self->wait;
+	self->moveinfo->wait = self->wait;
 
 	self->use = door_use;
 
@@ -2202,11 +2214,11 @@ train_wait(edict_t *self)
 		}
 	}
 
-	if (self->moveinfo.wait)
+	if (self->moveinfo->wait)
 	{
-		if (self->moveinfo.wait > 0)
+		if (self->moveinfo->wait > 0)
 		{
-			self->nextthink = level.time + self->moveinfo.wait;
+			self->nextthink = level.time + self->moveinfo->wait;
 			self->think = train_next;
 		}
 		else if (self->spawnflags & TRAIN_TOGGLE)
@@ -2219,10 +2231,10 @@ train_wait(edict_t *self)
 
 		if (!(self->flags & FL_TEAMSLAVE))
 		{
-			if (self->moveinfo.sound_end)
+			if (self->moveinfo->sound_end)
 			{
 				gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-						self->moveinfo.sound_end, 1,
+						self->moveinfo->sound_end, 1,
 						ATTN_STATIC, 0);
 			}
 
@@ -2284,25 +2296,25 @@ again:
 		goto again;
 	}
 
-	self->moveinfo.wait = ent->wait;
+	self->moveinfo->wait = ent->wait;
 	self->target_ent = ent;
 
 	if (!(self->flags & FL_TEAMSLAVE))
 	{
-		if (self->moveinfo.sound_start)
+		if (self->moveinfo->sound_start)
 		{
 			gi.sound(self, CHAN_NO_PHS_ADD + CHAN_VOICE,
-					self->moveinfo.sound_start, 1,
+					self->moveinfo->sound_start, 1,
 					ATTN_STATIC, 0);
 		}
 
-		self->s.sound = self->moveinfo.sound_middle;
+		self->s.sound = self->moveinfo->sound_middle;
 	}
 
 	VectorSubtract(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy(dest, self->moveinfo.end_origin);
+	self->moveinfo->state = STATE_TOP;
+	VectorCopy(self->s.origin, self->moveinfo->start_origin);
+	VectorCopy(dest, self->moveinfo->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -2321,9 +2333,9 @@ train_resume(edict_t *self)
 	ent = self->target_ent;
 
 	VectorSubtract(ent->s.origin, self->mins, dest);
-	self->moveinfo.state = STATE_TOP;
-	VectorCopy(self->s.origin, self->moveinfo.start_origin);
-	VectorCopy(dest, self->moveinfo.end_origin);
+	self->moveinfo->state = STATE_TOP;
+	VectorCopy(self->s.origin, self->moveinfo->start_origin);
+	VectorCopy(dest, self->moveinfo->end_origin);
 	Move_Calc(self, dest, train_wait);
 	self->spawnflags |= TRAIN_START_ON;
 }
@@ -2413,6 +2425,8 @@ SP_func_train(edict_t *self)
 		return;
 	}
 
+	G_AllocMoveInfo(self);
+
 	self->movetype = MOVETYPE_PUSH;
 
 	VectorClear(self->s.angles);
@@ -2435,7 +2449,7 @@ SP_func_train(edict_t *self)
 
 	if (st.noise)
 	{
-		self->moveinfo.sound_middle = gi.soundindex(st.noise);
+		self->moveinfo->sound_middle = gi.soundindex(st.noise);
 	}
 
 	if (!self->speed)
@@ -2443,8 +2457,8 @@ SP_func_train(edict_t *self)
 		self->speed = 100;
 	}
 
-	self->moveinfo.speed = self->speed;
-	self->moveinfo.accel = self->moveinfo.decel = self->moveinfo.speed;
+	self->moveinfo->speed = self->speed;
+	self->moveinfo->accel = self->moveinfo->decel = self->moveinfo->speed;
 
 	self->use = train_use;
 
@@ -2523,7 +2537,7 @@ trigger_elevator_init(edict_t *self)
 		return;
 	}
 
-	if (strcmp(self->movetarget->classname, "func_train") != 0)
+	if (G_ClassAtom(self->movetarget) != CN_func_train)
 	{
 		gi.dprintf("trigger_elevator target %s is not a train\n", self->target);
 		return;
@@ -2895,9 +2909,11 @@ SP_func_door_secret(edict_t *ent)
 		return;
 	}
 
-	ent->moveinfo.sound_start = gi.soundindex("doors/dr1_strt.wav");
-	ent->moveinfo.sound_middle = gi.soundindex("doors/dr1_mid.wav");
-	ent->moveinfo.sound_end = gi.soundindex("doors/dr1_end.wav");
+	G_AllocMoveInfo(ent);
+
+	ent->moveinfo->sound_start = gi.soundindex("doors/dr1_strt.wav");
+	ent->moveinfo->sound_middle = gi.soundindex("doors/dr1_mid.wav");
+	ent->moveinfo->sound_end = gi.soundindex("doors/dr1_end.wav");
 
 	ent->movetype = MOVETYPE_PUSH;
 	ent->solid = SOLID_BSP;
@@ -2923,8 +2939,8 @@ SP_func_door_secret(edict_t *ent)
 		ent->wait = 5;
 	}
 
-	ent->moveinfo.accel = ent->moveinfo.decel =
-		ent->moveinfo.speed = 50;
+	ent->moveinfo->accel = ent->moveinfo->decel =
+		ent->moveinfo->speed = 50;
 
 	/* calculate positions */
 	AngleVectors(ent->s.angles, forward, right, up);
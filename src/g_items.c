@@ -38,6 +38,7 @@ static int combat_armor_index;
 static int body_armor_index;
 static int power_screen_index;
 static int power_shield_index;
+int cells_index;
 
 void Use_Quad(edict_t *ent, gitem_t *item);
 static int quad_drop_timeout_hack;
@@ -55,62 +56,92 @@ GetItemByIndex(int index)
 	return &itemlist[index];
 }
 
-gitem_t *
-FindItemByClassname(char *classname)
+/*
+ * Name to itemlist index maps, built by InitItems().
+ * Open addressing, slots hold index + 1 (0 is empty).
+ */
+#define ITEM_HASH_SIZE (MAX_ITEMS * 2) /* power of two */
+#define ITOFS(x) (size_t)&(((gitem_t *)NULL)->x)
+
+static short item_classname_hash[ITEM_HASH_SIZE];
+static short item_pickup_name_hash[ITEM_HASH_SIZE];
+
+static char *
+ItemHashName(int index, size_t ofs)
 {
-	int i;
-	gitem_t *it;
+	return *(char **)((byte *)&itemlist[index] + ofs);
+}
 
-	if (!classname)
+static void
+ItemHashInsert(short *table, size_t ofs, int index)
+{
+	unsigned int slot;
+	char *name;
+
+	name = ItemHashName(index, ofs);
+
+	if (!name)
 	{
-		return NULL;
+		return;
 	}
 
-	it = itemlist;
+	slot = Q_strhash(name) & (ITEM_HASH_SIZE - 1);
 
-	for (i = 0; i < game.num_items; i++, it++)
+	while (table[slot])
 	{
-		if (!it->classname)
+		/* the first item with a name wins, as
+		   it did with the old linear search */
+		if (!Q_stricmp(ItemHashName(table[slot] - 1, ofs), name))
 		{
-			continue;
+			return;
 		}
 
-		if (!Q_stricmp(it->classname, classname))
+		slot = (slot + 1) & (ITEM_HASH_SIZE - 1);
+	}
+
+	table[slot] = index + 1;
+}
+
+static gitem_t *
+ItemHashFind(const short *table, size_t ofs, const char *name)
+{
+	unsigned int slot;
+
+	slot = Q_strhash(name) & (ITEM_HASH_SIZE - 1);
+
+	while (table[slot])
+	{
+		if (!Q_stricmp(ItemHashName(table[slot] - 1, ofs), name))
 		{
-			return it;
+			return &itemlist[table[slot] - 1];
 		}
+
+		slot = (slot + 1) & (ITEM_HASH_SIZE - 1);
 	}
 
 	return NULL;
 }
 
 gitem_t *
-FindItem(char *pickup_name)
+FindItemByClassname(char *classname)
 {
-	int i;
-	gitem_t *it;
-
-	if (!pickup_name)
+	if (!classname)
 	{
 		return NULL;
 	}
 
-	it = itemlist;
+	return ItemHashFind(item_classname_hash, ITOFS(classname), classname);
+}
 
-	for (i = 0; i < game.num_items; i++, it++)
+gitem_t *
+FindItem(char *pickup_name)
+{
+	if (!pickup_name)
 	{
-		if (!it->pickup_name)
-		{
-			continue;
-		}
-
-		if (!Q_stricmp(it->pickup_name, pickup_name))
-		{
-			return it;
-		}
+		return NULL;
 	}
 
-	return NULL;
+	return ItemHashFind(item_pickup_name_hash, ITOFS(pickup_name), pickup_name);
 }
 
 /* ====================================================================== */
@@ -601,7 +632,7 @@ Pickup_Key(edict_t *ent, edict_t *other)
 
 	if (coop->value)
 	{
-		if (strcmp(ent->classname, "key_power_cube") == 0)
+		if (G_ClassAtom(ent) == CN_key_power_cube)
 		{
 			if (other->client->pers.power_cubes &
 				((ent->spawnflags & 0x0000ff00) >> 8))
@@ -1025,7 +1056,7 @@ Use_PowerArmor(edict_t *ent, gitem_t *item)
 	}
 	else
 	{
-		index = ITEM_INDEX(FindItem("cells"));
+		index = cells_index;
 
 		if (!ent->client->pers.inventory[index])
 		{
@@ -2648,9 +2679,32 @@ SP_item_health_mega(edict_t *self)
 void
 InitItems(void)
 {
+	int i;
+
 	memset(itemlist, 0, sizeof(itemlist));
 	memcpy(itemlist, gameitemlist, sizeof(gameitemlist));
 	game.num_items = sizeof(gameitemlist) / sizeof(gameitemlist[0]) - 1;
+
+	/* name lookups */
+	memset(item_classname_hash, 0, sizeof(item_classname_hash));
+	memset(item_pickup_name_hash, 0, sizeof(item_pickup_name_hash));
+
+	for (i = 0; i < game.num_items; i++)
+	{
+		ItemHashInsert(item_classname_hash, ITOFS(classname), i);
+		ItemHashInsert(item_pickup_name_hash, ITOFS(pickup_name), i);
+	}
+
+	/* items looked up every frame */
+	jacket_armor_index = ITEM_INDEX(FindItem("Jacket Armor"));
+	combat_armor_index = ITEM_INDEX(FindItem("Combat Armor"));
+	body_armor_index = ITEM_INDEX(FindItem("Body Armor"));
+	power_screen_index = ITEM_INDEX(FindItem("Power Screen"));
+	power_shield_index = ITEM_INDEX(FindItem("Power Shield"));
+	cells_index = ITEM_INDEX(FindItem("Cells"));
+
+	/* weapons behaviour and ammo */
+	koiWeaponInit();
 }
 
 /*
@@ -2667,10 +2721,4 @@ SetItemNames(void)
 		it = &itemlist[i];
 		gi.configstring(CS_ITEMS + i, it->pickup_name);
 	}
-
-	jacket_armor_index = ITEM_INDEX(FindItem("Jacket Armor"));
-	combat_armor_index = ITEM_INDEX(FindItem("Combat Armor"));
-	body_armor_index = ITEM_INDEX(FindItem("Body Armor"));
-	power_screen_index = ITEM_INDEX(FindItem("Power Screen"));
-	power_shield_index = ITEM_INDEX(FindItem("Power Shield"));
 }
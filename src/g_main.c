@@ -37,6 +37,8 @@ int snd_fry;
 int meansOfDeath;
 
 edict_t *g_edicts;
+edict_t *g_clients[MAX_CLIENTS];
+int g_numclients;
 
 cvar_t *deathmatch;
 cvar_t *coop;
@@ -82,6 +84,9 @@ cvar_t *flood_msgs;
 cvar_t *flood_persecond;
 cvar_t *flood_waitdelay;
 
+cvar_t *cmd_rate;
+cvar_t *cmd_burst;
+
 cvar_t *sv_maplist;
 
 cvar_t *gib_on;
@@ -89,6 +94,7 @@ cvar_t *gib_on;
 cvar_t *aimfix;
 cvar_t *g_machinegun_norecoil;
 cvar_t *g_swap_speed;
+cvar_t *g_framestats;
 
 void G_RunFrame(void);
 
@@ -99,7 +105,15 @@ ShutdownGame(void)
 {
 	gi.dprintf("==== ShutdownGame ====\n");
 
+	G_ReplayShutdown();
+	G_NetStatsShutdown();
+	G_DumpEntitiesStop();
+
 	gi.FreeTags(TAG_LEVEL);
+	G_ClearTargetGraph();
+	G_ClearDelayedUses();
+	G_ClearInfoPools();
+	G_ClearLogicEdicts();
 	gi.FreeTags(TAG_GAME);
 }
 
@@ -172,7 +186,7 @@ GetGameAPI(game_import_t *import)
 	globals.edict_size = sizeof(edict_t);
 
 	/* Initalize the PRNG */
-	randk_seed();
+	randk_seed(0);
 
 	return &globals;
 }
@@ -217,15 +231,10 @@ ClientEndServerFrames(void)
 
 	/* calc the player views now that all
 	   pushing  and damage has been added */
-	for (i = 0; i < maxclients->value; i++)
+	for (i = 0; i < g_numclients; i++)
 	{
-		ent = g_edicts + 1 + i;
-
-		if (!ent->inuse || !ent->client)
-		{
-			continue;
-		}
-
+		ent = g_clients[i];
+		G_NetStatsSource(ent);
 		ClientEndServerFrame(ent);
 	}
 }
@@ -387,14 +396,9 @@ CheckDMRules(void)
 
 	if (fraglimit->value)
 	{
-		for (i = 0; i < maxclients->value; i++)
+		for (i = 0; i < g_numclients; i++)
 		{
-			cl = game.clients + i;
-
-			if (!g_edicts[i + 1].inuse)
-			{
-				continue;
-			}
+			cl = g_clients[i]->client;
 
 			if (cl->resp.score >= fraglimit->value)
 			{
@@ -421,14 +425,9 @@ ExitLevel(void)
 	ClientEndServerFrames();
 
 	/* clear some things before going to next level */
-	for (i = 0; i < maxclients->value; i++)
+	for (i = 0; i < g_numclients; i++)
 	{
-		ent = g_edicts + 1 + i;
-
-		if (!ent->inuse)
-		{
-			continue;
-		}
+		ent = g_clients[i];
 
 		if (ent->health > ent->max_health)
 		{
@@ -440,6 +439,64 @@ ExitLevel(void)
 	gibsthisframe = 0;
 }
 
+/*
+ * Entities without physics only need
+ * G_RunEntity() when their think is due,
+ * see SV_RunThink(). nextthink stays the
+ * only state, so savegames are unaffected.
+ */
+static qboolean
+G_EntitySleeps(const edict_t *ent)
+{
+	if ((ent->movetype != MOVETYPE_NONE) || ent->prethink)
+	{
+		return false;
+	}
+
+	return (ent->nextthink <= 0) || (ent->nextthink > level.time + 0.001);
+}
+
+/*
+ * Prints the average cost of G_RunFrame()
+ * every 10 seconds while g_framestats is set.
+ */
+static void
+G_FrameStats(clock_t start, int run, int slept)
+{
+	static double total, max;
+	static int frames, runs, sleeps;
+	double msec;
+
+	if (!g_framestats->value)
+	{
+		frames = 0;
+		return;
+	}
+
+	if (!frames)
+	{
+		total = max = 0;
+		runs = sleeps = 0;
+	}
+
+	msec = (clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+	total += msec;
+	runs += run;
+	sleeps += slept;
+
+	if (msec > max)
+	{
+		max = msec;
+	}
+
+	if (++frames == 100)
+	{
+		gi.dprintf("frame %.3f ms avg, %.3f ms max, %i entities run, %i sleeping\n",
+				total / frames, max, runs / frames, sleeps / frames);
+		frames = 0;
+	}
+}
+
 /*
  * Advances the world by 0.1 seconds
  */
@@ -448,6 +505,14 @@ G_RunFrame(void)
 {
 	int i;
 	edict_t *ent;
+	clock_t start;
+	int run = 0;
+	int slept = 0;
+
+	start = clock();
+
+	/* recorded input belongs to the last frame */
+	G_ReplayBeginFrame();
 
 	level.framenum++;
 	level.time = level.framenum * FRAMETIME;
@@ -465,6 +530,9 @@ G_RunFrame(void)
 		return;
 	}
 
+	/* fire delayed targets that are due */
+	G_RunDelayedUses();
+
 	/* treat each object in turn
 	   even the world gets a chance
 	   to think */
@@ -478,6 +546,7 @@ G_RunFrame(void)
 		}
 
 		level.current_entity = ent;
+		G_NetStatsSource(ent);
 
 		VectorCopy(ent->s.origin, ent->s.old_origin);
 
@@ -500,9 +569,42 @@ G_RunFrame(void)
 			continue;
 		}
 
+		if (G_EntitySleeps(ent))
+		{
+			slept++;
+			continue;
+		}
+
 		G_RunEntity(ent);
+		run++;
 	}
 
+	/* the logic entities after all others */
+	for (ent = G_EdictFrom(game.maxentities); ent; ent = G_NextEdict(ent))
+	{
+		if (!ent->inuse)
+		{
+			continue;
+		}
+
+		level.current_entity = ent;
+		G_NetStatsSource(ent);
+
+		if (G_EntitySleeps(ent))
+		{
+			slept++;
+			continue;
+		}
+
+		G_RunEntity(ent);
+		run++;
+	}
+
+	G_NetStatsSource(NULL);
+
+	/* blocks of the edicts freed this frame */
+	G_ReleaseInfoBlocks();
+
 	/* see if it is time to end a deathmatch */
 	CheckDMRules();
 
@@ -511,4 +613,12 @@ G_RunFrame(void)
 
 	/* build the playerstate_t structures for all players */
 	ClientEndServerFrames();
+
+	G_ReplayEndFrame();
+
+	G_DumpEntitiesFrame();
+
+	G_NetStatsFrame();
+
+	G_FrameStats(start, run, slept);
 }
@@ -65,9 +65,9 @@ SP_func_areaportal(edict_t *ent)
 void
 VelocityForDamage(int damage, vec3_t v)
 {
-	v[0] = 100.0 * crandom();
-	v[1] = 100.0 * crandom();
-	v[2] = 200.0 + 100.0 * random();
+	v[0] = 100.0 * crandom_s(RANDK_GIBS);
+	v[1] = 100.0 * crandom_s(RANDK_GIBS);
+	v[2] = 200.0 + 100.0 * random_s(RANDK_GIBS);
 
 	if (damage < 50)
 	{
@@ -131,7 +131,7 @@ gib_think(edict_t *self)
 	if (self->s.frame == 10)
 	{
 		self->think = G_FreeEdict;
-		self->nextthink = level.time + 8 + random() * 10;
+		self->nextthink = level.time + 8 + random_s(RANDK_GIBS) * 10;
 	}
 }
 
@@ -212,9 +212,9 @@ ThrowGib(edict_t *self, char *gibname, int damage, int type)
 
 	VectorScale(self->size, 0.5, size);
 	VectorAdd(self->absmin, size, origin);
-	gib->s.origin[0] = origin[0] + crandom() * size[0];
-	gib->s.origin[1] = origin[1] + crandom() * size[1];
-	gib->s.origin[2] = origin[2] + crandom() * size[2];
+	gib->s.origin[0] = origin[0] + crandom_s(RANDK_GIBS) * size[0];
+	gib->s.origin[1] = origin[1] + crandom_s(RANDK_GIBS) * size[1];
+	gib->s.origin[2] = origin[2] + crandom_s(RANDK_GIBS) * size[2];
 
 	gi.setmodel(gib, gibname);
 	gib->solid = SOLID_BBOX;
@@ -240,12 +240,12 @@ ThrowGib(edict_t *self, char *gibname, int damage, int type)
 	VelocityForDamage(damage, vd);
 	VectorMA(self->velocity, vscale, vd, gib->velocity);
 	ClipGibVelocity(gib);
-	gib->avelocity[0] = random() * 600;
-	gib->avelocity[1] = random() * 600;
-	gib->avelocity[2] = random() * 600;
+	gib->avelocity[0] = random_s(RANDK_GIBS) * 600;
+	gib->avelocity[1] = random_s(RANDK_GIBS) * 600;
+	gib->avelocity[2] = random_s(RANDK_GIBS) * 600;
 
 	gib->think = G_FreeEdict;
-	gib->nextthink = level.time + 10 + random() * 10;
+	gib->nextthink = level.time + 10 + random_s(RANDK_GIBS) * 10;
 
 	gi.linkentity(gib);
 }
@@ -299,10 +299,10 @@ ThrowHead(edict_t *self, char *gibname, int damage, int type)
 	VectorMA(self->velocity, vscale, vd, self->velocity);
 	ClipGibVelocity(self);
 
-	self->avelocity[YAW] = crandom() * 600;
+	self->avelocity[YAW] = crandom_s(RANDK_GIBS) * 600;
 
 	self->think = G_FreeEdict;
-	self->nextthink = level.time + 10 + random() * 10;
+	self->nextthink = level.time + 10 + random_s(RANDK_GIBS) * 10;
 
 	gi.linkentity(self);
 }
@@ -318,7 +318,7 @@ ThrowClientHead(edict_t *self, int damage)
 		return;
 	}
 
-	if (randk() & 1)
+	if (randk_s(RANDK_GIBS) & 1)
 	{
 		gibname = "models/objects/gibs/head2/tris.md2";
 		self->s.skinnum = 1; /* second skin is player */
@@ -405,17 +405,17 @@ ThrowDebris(edict_t *self, char *modelname, float speed, vec3_t origin)
 
 	VectorCopy(origin, chunk->s.origin);
 	gi.setmodel(chunk, modelname);
-	v[0] = 100 * crandom();
-	v[1] = 100 * crandom();
-	v[2] = 100 + 100 * crandom();
+	v[0] = 100 * crandom_s(RANDK_GIBS);
+	v[1] = 100 * crandom_s(RANDK_GIBS);
+	v[2] = 100 + 100 * crandom_s(RANDK_GIBS);
 	VectorMA(self->velocity, speed, v, chunk->velocity);
 	chunk->movetype = MOVETYPE_BOUNCE;
 	chunk->solid = SOLID_NOT;
-	chunk->avelocity[0] = random() * 600;
-	chunk->avelocity[1] = random() * 600;
-	chunk->avelocity[2] = random() * 600;
+	chunk->avelocity[0] = random_s(RANDK_GIBS) * 600;
+	chunk->avelocity[1] = random_s(RANDK_GIBS) * 600;
+	chunk->avelocity[2] = random_s(RANDK_GIBS) * 600;
 	chunk->think = G_FreeEdict;
-	chunk->nextthink = level.time + 5 + random() * 5;
+	chunk->nextthink = level.time + 5 + random_s(RANDK_GIBS) * 5;
 	chunk->s.frame = 0;
 	chunk->flags = 0;
 	chunk->classname = "debris";
@@ -433,10 +433,13 @@ BecomeExplosion1(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION1);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	if (G_EffectVisible(self->s.origin, MULTICAST_PVS, EFFECT_POINT))
+	{
+		gi.WriteByte(svc_temp_entity);
+		gi.WriteByte(TE_EXPLOSION1);
+		gi.WritePosition(self->s.origin);
+		gi.multicast(self->s.origin, MULTICAST_PVS);
+	}
 
 	G_FreeEdict(self);
 }
@@ -449,10 +452,13 @@ BecomeExplosion2(edict_t *self)
 		return;
 	}
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_EXPLOSION2);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	if (G_EffectVisible(self->s.origin, MULTICAST_PVS, EFFECT_POINT))
+	{
+		gi.WriteByte(svc_temp_entity);
+		gi.WriteByte(TE_EXPLOSION2);
+		gi.WritePosition(self->s.origin);
+		gi.multicast(self->s.origin, MULTICAST_PVS);
+	}
 
 	G_FreeEdict(self);
 }
@@ -519,15 +525,15 @@ path_corner_touch(edict_t *self, edict_t *other, cplane_t *plane /* unused */,
 
 	if (self->wait)
 	{
-		other->monsterinfo.pausetime = level.time + self->wait;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + self->wait;
+		other->monsterinfo->stand(other);
 		return;
 	}
 
 	if (!other->movetarget)
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + 100000000;
+		other->monsterinfo->stand(other);
 	}
 	else
 	{
@@ -603,9 +609,9 @@ point_combat_touch(edict_t *self, edict_t *other, cplane_t *plane /* unused */,
 	}
 	else if ((self->spawnflags & 1) && !(other->flags & (FL_SWIM | FL_FLY)))
 	{
-		other->monsterinfo.pausetime = level.time + 100000000;
-		other->monsterinfo.aiflags |= AI_STAND_GROUND;
-		other->monsterinfo.stand(other);
+		other->monsterinfo->pausetime = level.time + 100000000;
+		other->monsterinfo->aiflags |= AI_STAND_GROUND;
+		other->monsterinfo->stand(other);
 	}
 
 	if (other->movetarget == self)
@@ -613,7 +619,7 @@ point_combat_touch(edict_t *self, edict_t *other, cplane_t *plane /* unused */,
 		other->target = NULL;
 		other->movetarget = NULL;
 		other->goalentity = other->enemy;
-		other->monsterinfo.aiflags &= ~AI_COMBAT_POINT;
+		other->monsterinfo->aiflags &= ~AI_COMBAT_POINT;
 	}
 
 	if (self->pathtarget)
@@ -1346,6 +1352,8 @@ SP_misc_explobox(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	gi.modelindex("models/objects/debris1/tris.md2");
 	gi.modelindex("models/objects/debris2/tris.md2");
 	gi.modelindex("models/objects/debris3/tris.md2");
@@ -1375,7 +1383,7 @@ SP_misc_explobox(edict_t *self)
 
 	self->die = barrel_delay;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.aiflags = AI_NOSTEP;
+	self->monsterinfo->aiflags = AI_NOSTEP;
 
 	self->touch = barrel_touch;
 
@@ -1685,6 +1693,7 @@ SP_monster_commander_body(edict_t *self)
 	{
 		self->deadflag = DEAD_DEAD;
 		self->svflags |= SVF_MONSTER | SVF_DEADMONSTER;
+		G_AllocMonsterInfo(self);
 		self->die = commander_body_die;
 	}
 	else
@@ -1788,6 +1797,8 @@ SP_misc_deadsoldier(edict_t *ent)
 		return;
 	}
 
+	G_AllocMonsterInfo(ent);
+
 	ent->movetype = MOVETYPE_NONE;
 	ent->solid = SOLID_BBOX;
 	ent->s.modelindex = gi.modelindex("models/deadbods/dude/tris.md2");
@@ -1824,7 +1835,7 @@ SP_misc_deadsoldier(edict_t *ent)
 	ent->takedamage = DAMAGE_YES;
 	ent->svflags |= SVF_MONSTER | SVF_DEADMONSTER;
 	ent->die = misc_deadsoldier_die;
-	ent->monsterinfo.aiflags |= AI_GOOD_GUY;
+	ent->monsterinfo->aiflags |= AI_GOOD_GUY;
 
 	gi.linkentity(ent);
 }
@@ -1871,6 +1882,8 @@ SP_misc_viper(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	if (!ent->speed)
 	{
 		ent->speed = 300;
@@ -1886,7 +1899,7 @@ SP_misc_viper(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_viper_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel = ent->moveinfo.speed =
+	ent->moveinfo->accel = ent->moveinfo->decel = ent->moveinfo->speed =
 													ent->speed;
 
 	gi.linkentity(ent);
@@ -1951,7 +1964,7 @@ misc_viper_bomb_prethink(edict_t *self)
 		diff = -1.0;
 	}
 
-	VectorScale(self->moveinfo.dir, 1.0 + diff, v);
+	VectorScale(self->moveinfo->dir, 1.0 + diff, v);
 	v[2] = diff;
 
 	diff = self->s.angles[2];
@@ -1979,10 +1992,10 @@ misc_viper_bomb_use(edict_t *self, edict_t *other /* unused */, edict_t *activat
 	self->activator = activator;
 
 	viper = G_Find(NULL, FOFS(classname), "misc_viper");
-	VectorScale(viper->moveinfo.dir, viper->moveinfo.speed, self->velocity);
+	VectorScale(viper->moveinfo->dir, viper->moveinfo->speed, self->velocity);
 
 	self->timestamp = level.time;
-	VectorCopy(viper->moveinfo.dir, self->moveinfo.dir);
+	VectorCopy(viper->moveinfo->dir, self->moveinfo->dir);
 }
 
 void
@@ -1993,6 +2006,8 @@ SP_misc_viper_bomb(edict_t *self)
 		return;
 	}
 
+	G_AllocMoveInfo(self);
+
 	self->movetype = MOVETYPE_NONE;
 	self->solid = SOLID_NOT;
 	VectorSet(self->mins, -8, -8, -8);
@@ -2054,6 +2069,8 @@ SP_misc_strogg_ship(edict_t *ent)
 		return;
 	}
 
+	G_AllocMoveInfo(ent);
+
 	if (!ent->speed)
 	{
 		ent->speed = 300;
@@ -2069,8 +2086,8 @@ SP_misc_strogg_ship(edict_t *ent)
 	ent->nextthink = level.time + FRAMETIME;
 	ent->use = misc_strogg_ship_use;
 	ent->svflags |= SVF_NOCLIENT;
-	ent->moveinfo.accel = ent->moveinfo.decel =
-		ent->moveinfo.speed = ent->speed;
+	ent->moveinfo->accel = ent->moveinfo->decel =
+		ent->moveinfo->speed = ent->speed;
 
 	gi.linkentity(ent);
 }
@@ -2176,6 +2193,8 @@ SP_misc_gib_arm(edict_t *ent)
 		return;
 	}
 
+	G_AllocMonsterInfo(ent);
+
 	gi.setmodel(ent, "models/objects/gibs/arm/tris.md2");
 	ent->solid = SOLID_BBOX;
 	ent->s.effects |= EF_GIB;
@@ -2204,6 +2223,8 @@ SP_misc_gib_leg(edict_t *ent)
 		return;
 	}
 
+	G_AllocMonsterInfo(ent);
+
 	gi.setmodel(ent, "models/objects/gibs/leg/tris.md2");
 	ent->solid = SOLID_BBOX;
 	ent->s.effects |= EF_GIB;
@@ -2232,6 +2253,8 @@ SP_misc_gib_head(edict_t *ent)
 		return;
 	}
 
+	G_AllocMonsterInfo(ent);
+
 	gi.setmodel(ent, "models/objects/gibs/head/tris.md2");
 	ent->solid = SOLID_BBOX;
 	ent->s.effects |= EF_GIB;
@@ -41,10 +41,13 @@ monster_fire_bullet(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_bullet(self, start, dir, damage, kick, hspread, vspread, MOD_UNKNOWN);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -59,10 +62,13 @@ monster_fire_shotgun(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	fire_shotgun(self, start, aimdir, damage, kick, hspread,
 			vspread, count, MOD_UNKNOWN);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -76,10 +82,13 @@ monster_fire_blaster(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 	fire_blaster(self, start, dir, damage, speed, effect, false);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -93,10 +102,13 @@ monster_fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir,
 
 	fire_grenade(self, start, aimdir, damage, speed, 2.5, damage + 40);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -110,10 +122,13 @@ monster_fire_rocket(edict_t *self, vec3_t start, vec3_t dir,
 
 	fire_rocket(self, start, dir, damage, speed, damage + 20, damage);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -127,10 +142,13 @@ monster_fire_railgun(edict_t *self, vec3_t start, vec3_t aimdir,
 
 	fire_rail(self, start, aimdir, damage, kick);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 void
@@ -145,10 +163,13 @@ monster_fire_bfg(edict_t *self, vec3_t start, vec3_t aimdir,
 
 	fire_bfg(self, start, aimdir, damage, speed, damage_radius);
 
-	gi.WriteByte(svc_muzzleflash2);
-	gi.WriteShort(self - g_edicts);
-	gi.WriteByte(flashtype);
-	gi.multicast(start, MULTICAST_PVS);
+	if (G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
+	{
+		gi.WriteByte(svc_muzzleflash2);
+		gi.WriteShort(self - g_edicts);
+		gi.WriteByte(flashtype);
+		gi.multicast(start, MULTICAST_PVS);
+	}
 }
 
 /* ================================================================== */
@@ -199,13 +220,13 @@ M_FlyCheck(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.5)
+	if (random_s(RANDK_AI) > 0.5)
 	{
 		return;
 	}
 
 	self->think = M_FliesOn;
-	self->nextthink = level.time + 5 + 10 * random();
+	self->nextthink = level.time + 5 + 10 * random_s(RANDK_AI);
 }
 
 void
@@ -216,7 +237,7 @@ AttackFinished(edict_t *self, float time)
 		return;
 	}
 
-	self->monsterinfo.attack_finished = level.time + time;
+	self->monsterinfo->attack_finished = level.time + time;
 }
 
 void
@@ -410,7 +431,7 @@ M_WorldEffects(edict_t *ent)
 		{
 			if (ent->watertype & CONTENTS_LAVA)
 			{
-				if (random() <= 0.5)
+				if (random_s(RANDK_AI) <= 0.5)
 				{
 					gi.sound(ent, CHAN_BODY, gi.soundindex(
 									"player/lava1.wav"), 1, ATTN_NORM, 0);
@@ -479,7 +500,7 @@ M_SetEffects(edict_t *ent)
 	ent->s.effects &= ~(EF_COLOR_SHELL | EF_POWERSCREEN);
 	ent->s.renderfx &= ~(RF_SHELL_RED | RF_SHELL_GREEN | RF_SHELL_BLUE);
 
-	if (ent->monsterinfo.aiflags & AI_RESURRECTING)
+	if (ent->monsterinfo->aiflags & AI_RESURRECTING)
 	{
 		ent->s.effects |= EF_COLOR_SHELL;
 		ent->s.renderfx |= RF_SHELL_RED;
@@ -492,11 +513,11 @@ M_SetEffects(edict_t *ent)
 
 	if (ent->powerarmor_time > level.time)
 	{
-		if (ent->monsterinfo.power_armor_type == POWER_ARMOR_SCREEN)
+		if (ent->monsterinfo->power_armor_type == POWER_ARMOR_SCREEN)
 		{
 			ent->s.effects |= EF_POWERSCREEN;
 		}
-		else if (ent->monsterinfo.power_armor_type == POWER_ARMOR_SHIELD)
+		else if (ent->monsterinfo->power_armor_type == POWER_ARMOR_SHIELD)
 		{
 			ent->s.effects |= EF_COLOR_SHELL;
 			ent->s.renderfx |= RF_SHELL_GREEN;
@@ -504,6 +525,63 @@ M_SetEffects(edict_t *ent)
 	}
 }
 
+/*
+ * Copies all animations into one contiguous table,
+ * in the order of the savegame mmove list. Each
+ * mmove_t is numbered with its place in the table
+ * and monsterinfo->currentmove holds that number.
+ * Moves with a backwards frame range aren't copied
+ * and keep their original frames. Slot 0 is left
+ * empty for "no move". Rebuilt by every InitGame().
+ */
+static mmove_t *m_moves;
+static mframe_t *m_frames;
+
+static int
+M_MoveFrames(const mmove_t *move)
+{
+	return move->lastframe - move->firstframe + 1;
+}
+
+void
+M_InitMoves(void)
+{
+	mmove_t *move;
+	int i, count, numframes;
+
+	numframes = 0;
+
+	for (i = 0; (move = GetMmoveByIndex(i)); i++)
+	{
+		if ((count = M_MoveFrames(move)) > 0)
+		{
+			numframes += count;
+		}
+	}
+
+	m_moves = gi.TagMalloc((i + 1) * sizeof(*m_moves), TAG_GAME);
+	m_frames = gi.TagMalloc(numframes * sizeof(*m_frames), TAG_GAME);
+	numframes = 0;
+
+	for (i = 0; (move = GetMmoveByIndex(i)); i++)
+	{
+		move->id = i + 1;
+		m_moves[move->id] = *move;
+		count = M_MoveFrames(move);
+
+		if (count <= 0)
+		{
+			gi.dprintf("M_InitMoves: move %i runs from frame %i back to %i\n",
+					i, move->firstframe, move->lastframe);
+			continue;
+		}
+
+		m_moves[move->id].frame = m_frames + numframes;
+		memcpy(m_moves[move->id].frame, move->frame, count * sizeof(*m_frames));
+		numframes += count;
+	}
+}
+
 void
 M_MoveFrame(edict_t *self)
 {
@@ -515,25 +593,25 @@ M_MoveFrame(edict_t *self)
 		return;
 	}
 
-	move = self->monsterinfo.currentmove;
+	move = &m_moves[self->monsterinfo->currentmove];
 	self->nextthink = level.time + FRAMETIME;
 
-	if ((self->monsterinfo.nextframe) &&
-		(self->monsterinfo.nextframe >= move->firstframe) &&
-		(self->monsterinfo.nextframe <= move->lastframe))
+	if ((self->monsterinfo->nextframe) &&
+		(self->monsterinfo->nextframe >= move->firstframe) &&
+		(self->monsterinfo->nextframe <= move->lastframe))
 	{
-		if (self->s.frame != self->monsterinfo.nextframe)
+		if (self->s.frame != self->monsterinfo->nextframe)
 		{
-			self->s.frame = self->monsterinfo.nextframe;
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self->s.frame = self->monsterinfo->nextframe;
+			self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 		}
 
-		self->monsterinfo.nextframe = 0;
+		self->monsterinfo->nextframe = 0;
 	}
 	else
 	{
 		/* prevent nextframe from leaking into a future move */
-		self->monsterinfo.nextframe = 0;
+		self->monsterinfo->nextframe = 0;
 
 		if (self->s.frame == move->lastframe)
 		{
@@ -542,7 +620,7 @@ M_MoveFrame(edict_t *self)
 				move->endfunc(self);
 
 				/* regrab move, endfunc is very likely to change it */
-				move = self->monsterinfo.currentmove;
+				move = &m_moves[self->monsterinfo->currentmove];
 
 				/* check for death */
 				if (self->svflags & SVF_DEADMONSTER)
@@ -555,12 +633,12 @@ M_MoveFrame(edict_t *self)
 		if ((self->s.frame < move->firstframe) ||
 			(self->s.frame > move->lastframe))
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 			self->s.frame = move->firstframe;
 		}
 		else
 		{
-			if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+			if (!(self->monsterinfo->aiflags & AI_HOLD_FRAME))
 			{
 				self->s.frame++;
 
@@ -576,10 +654,10 @@ M_MoveFrame(edict_t *self)
 
 	if (move->frame[index].aifunc)
 	{
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(self->monsterinfo->aiflags & AI_HOLD_FRAME))
 		{
 			move->frame[index].aifunc(self,
-					move->frame[index].dist * self->monsterinfo.scale);
+					move->frame[index].dist * self->monsterinfo->scale);
 		}
 		else
 		{
@@ -603,9 +681,9 @@ monster_think(edict_t *self)
 
 	M_MoveFrame(self);
 
-	if (self->linkcount != self->monsterinfo.linkcount)
+	if (self->linkcount != self->monsterinfo->linkcount)
 	{
-		self->monsterinfo.linkcount = self->linkcount;
+		self->monsterinfo->linkcount = self->linkcount;
 		M_CheckGround(self);
 	}
 
@@ -641,7 +719,8 @@ monster_use(edict_t *self, edict_t *other /* unused */, edict_t *activator)
 		return;
 	}
 
-	if (!(activator->client) && !(activator->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(activator->client) && !(activator->monsterinfo &&
+		(activator->monsterinfo->aiflags & AI_GOOD_GUY)))
 	{
 		return;
 	}
@@ -731,7 +810,7 @@ monster_death_use(edict_t *self)
 	}
 
 	self->flags &= ~(FL_FLY | FL_SWIM);
-	self->monsterinfo.aiflags &= AI_GOOD_GUY;
+	self->monsterinfo->aiflags &= AI_GOOD_GUY;
 
 	if (self->item)
 	{
@@ -757,6 +836,8 @@ monster_death_use(edict_t *self)
 qboolean
 monster_start(edict_t *self)
 {
+	mmove_t *move;
+
 	if (!self)
 	{
 		return false;
@@ -768,7 +849,7 @@ monster_start(edict_t *self)
 		return false;
 	}
 
-	if ((self->spawnflags & 4) && !(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if ((self->spawnflags & 4) && !(self->monsterinfo->aiflags & AI_GOOD_GUY))
 	{
 		self->spawnflags &= ~4;
 		self->spawnflags |= 1;
@@ -784,7 +865,7 @@ monster_start(edict_t *self)
 		gi.dprintf ("triggered %s at %s has no targetname\n", self->classname, vtos (self->s.origin));
 	}
 
-	if (!(self->monsterinfo.aiflags & AI_GOOD_GUY))
+	if (!(self->monsterinfo->aiflags & AI_GOOD_GUY))
 	{
 		level.total_monsters++;
 	}
@@ -807,9 +888,9 @@ monster_start(edict_t *self)
 	self->deadflag = DEAD_NO;
 	self->svflags &= ~SVF_DEADMONSTER;
 
-	if (!self->monsterinfo.checkattack)
+	if (!self->monsterinfo->checkattack)
 	{
-		self->monsterinfo.checkattack = M_CheckAttack;
+		self->monsterinfo->checkattack = M_CheckAttack;
 	}
 
 	VectorCopy(self->s.origin, self->s.old_origin);
@@ -826,11 +907,11 @@ monster_start(edict_t *self)
 	}
 
 	/* randomize what frame they start on */
-	if (self->monsterinfo.currentmove)
+	if (self->monsterinfo->currentmove)
 	{
-		self->s.frame = self->monsterinfo.currentmove->firstframe +
-			(randk() % (self->monsterinfo.currentmove->lastframe -
-					   self->monsterinfo.currentmove->firstframe + 1));
+		move = &m_moves[self->monsterinfo->currentmove];
+		self->s.frame = move->firstframe +
+			(randk_s(RANDK_AI) % (move->lastframe - move->firstframe + 1));
 	}
 
 	return true;
@@ -864,7 +945,7 @@ monster_start_go(edict_t *self)
 
 		while ((target = G_Find(target, FOFS(targetname), self->target)) != NULL)
 		{
-			if (strcmp(target->classname, "point_combat") == 0)
+			if (G_ClassAtom(target) == CN_point_combat)
 			{
 				self->combattarget = self->target;
 				fixup = true;
@@ -897,7 +978,7 @@ monster_start_go(edict_t *self)
 		while ((target = G_Find(target, FOFS(targetname),
 						self->combattarget)) != NULL)
 		{
-			if (strcmp(target->classname, "point_combat") != 0)
+			if (G_ClassAtom(target) != CN_point_combat)
 			{
 				gi.dprintf( "%s at (%i %i %i) has a bad combattarget %s : %s at (%i %i %i)\n",
 						self->classname, (int)self->s.origin[0], (int)self->s.origin[1],
@@ -917,27 +998,27 @@ monster_start_go(edict_t *self)
 			gi.dprintf("%s can't find target %s at %s\n", self->classname,
 					self->target, vtos(self->s.origin));
 			self->target = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			self->monsterinfo->pausetime = 100000000;
+			self->monsterinfo->stand(self);
 		}
-		else if (strcmp(self->movetarget->classname, "path_corner") == 0)
+		else if (G_ClassAtom(self->movetarget) == CN_path_corner)
 		{
 			VectorSubtract(self->goalentity->s.origin, self->s.origin, v);
 			self->ideal_yaw = self->s.angles[YAW] = vectoyaw(v);
-			self->monsterinfo.walk(self);
+			self->monsterinfo->walk(self);
 			self->target = NULL;
 		}
 		else
 		{
 			self->goalentity = self->movetarget = NULL;
-			self->monsterinfo.pausetime = 100000000;
-			self->monsterinfo.stand(self);
+			self->monsterinfo->pausetime = 100000000;
+			self->monsterinfo->stand(self);
 		}
 	}
 	else
 	{
-		self->monsterinfo.pausetime = 100000000;
-		self->monsterinfo.stand(self);
+		self->monsterinfo->pausetime = 100000000;
+		self->monsterinfo->stand(self);
 	}
 
 	self->think = monster_think;
@@ -0,0 +1,888 @@
+/*
+ * Copyright (C) 1997-2001 Id Software, Inc.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ * 02111-1307, USA.
+ *
+ * =======================================================================
+ *
+ * Network accounting. Wraps the gi.Write*(), multicast, unicast,
+ * print and configstring imports and tallies what the game sends,
+ * by message type, by multicast kind, by source and by client.
+ *
+ * =======================================================================
+ */
+
+/*
+ * Usage:
+ *
+ * g_netstats <0 or 1>
+ *  Tallies every message the game writes. The imports are only
+ *  wrapped while this is on, so it costs nothing when off.
+ *
+ * g_netlog <0 or 1>
+ *  With g_netstats on, writes one line per frame to
+ *  "netstats-<mapname>.csv" in the game directory.
+ *
+ * g_effectcull <0 or 1>
+ *  Emitters of PVS and PHS effects ask G_EffectVisible() first
+ *  and skip the message when no client could receive it. Off by
+ *  default: server side demos (serverrecord) store every multicast
+ *  and the game can't tell when one is recording. Turn it on for
+ *  servers that don't record.
+ *
+ * sv netstats [reset]
+ *  Prints the tallies, or clears them.
+ *
+ * Sizes are what the game hands to the server, the server adds
+ * its own framing and may drop unreliable messages. Multicasts
+ * are charged to every client in the PVS or PHS of their origin,
+ * which is what the server checks too. The source of a message
+ * is the entity that was running and, if known, the think, touch
+ * or use function it was in.
+ */
+
+#include "header/local.h"
+#include "savegame/savegame.h"
+
+/* server messages, from the protocol */
+#define NET_SVC_PRINT 10
+#define NET_SVC_CONFIGSTRING 13
+#define NET_SVC_CENTERPRINT 15
+#define NET_SVC_UNKNOWN 255 /* didn't start with a byte */
+
+#define NET_MAX_TEMPENTS 64
+#define NET_MAX_SOURCES 256
+#define NET_MAX_DEPTH 16
+
+/* how a message went out, the multicast_t values first */
+enum
+{
+	NK_UNICAST = MULTICAST_PVS_R + 1,
+	NK_UNICAST_R,
+	NK_CONFIGSTRING,
+	NK_PRINT,
+	NK_CENTERPRINT,
+	NK_NUMKINDS
+};
+
+typedef struct
+{
+	unsigned int count;
+	double bytes;
+} netcount_t;
+
+typedef struct
+{
+	int classatom;
+	void *func;
+	netcount_t c;
+} netsource_t;
+
+typedef struct
+{
+	edict_t *ent;
+	void *func;
+} netcaller_t;
+
+static const char *net_svcnames[] = {
+	"bad", "muzzleflash", "muzzleflash2", "temp_entity", "layout",
+	"inventory", "nop", "disconnect", "reconnect", "sound", "print",
+	"stufftext", "serverdata", "configstring", "spawnbaseline",
+	"centerprint", "download", "playerinfo", "packetentities",
+	"deltapacketentities", "frame"
+};
+
+static const char *net_kindnames[NK_NUMKINDS] = {
+	"multicast all", "multicast phs", "multicast pvs",
+	"multicast all reliable", "multicast phs reliable",
+	"multicast pvs reliable", "unicast", "unicast reliable",
+	"configstring", "print", "centerprint"
+};
+
+static cvar_t *g_netstats;
+static cvar_t *g_netlog;
+static cvar_t *g_effectcull;
+
+static game_import_t net_real; /* the servers imports while wrapped */
+static qboolean net_wrapped;
+
+/* the message being written */
+static int net_msgbytes;
+static int net_msgtype;
+static int net_msgte;
+
+static netcaller_t net_callers[NET_MAX_DEPTH];
+static int net_depth;
+
+static netcount_t net_types[256];
+static netcount_t net_tempents[NET_MAX_TEMPENTS];
+static netcount_t net_kinds[NK_NUMKINDS];
+static netcount_t net_clients[MAX_CLIENTS];
+static netsource_t net_sources[NET_MAX_SOURCES];
+static int net_numsources;
+static unsigned int net_frames;
+
+/* this frame, for g_netlog */
+static netcount_t net_frame;
+static double net_framekinds[NK_NUMKINDS];
+static double net_frameclients[MAX_CLIENTS];
+
+static FILE *net_log;
+static char net_logmap[MAX_QPATH];
+
+static unsigned int net_effects[MULTICAST_PVS_R + 1];
+static unsigned int net_culled[MULTICAST_PVS_R + 1];
+static double net_culledbytes[MULTICAST_PVS_R + 1];
+
+/* one client per cluster and area, for G_EffectVisible() */
+static edict_t *net_locations[MAX_CLIENTS];
+static int net_numlocations;
+static qboolean net_locationsstale = true;
+
+/* ====================================================================== */
+
+static netsource_t *
+NetSource(void)
+{
+	netcaller_t *caller;
+	int classatom, i;
+
+	i = (net_depth < NET_MAX_DEPTH) ? net_depth : NET_MAX_DEPTH - 1;
+	caller = &net_callers[i];
+	classatom = CN_NONE;
+
+	if (caller->ent && caller->ent->inuse)
+	{
+		classatom = G_ClassAtom(caller->ent);
+	}
+
+	for (i = 0; i < net_numsources; i++)
+	{
+		if ((net_sources[i].classatom == classatom) &&
+			(net_sources[i].func == caller->func))
+		{
+			return &net_sources[i];
+		}
+	}
+
+	/* the last slot takes the rest */
+	if (net_numsources == NET_MAX_SOURCES - 1)
+	{
+		net_numsources = NET_MAX_SOURCES;
+	}
+
+	if (net_numsources == NET_MAX_SOURCES)
+	{
+		return &net_sources[NET_MAX_SOURCES - 1];
+	}
+
+	net_sources[net_numsources].classatom = classatom;
+	net_sources[net_numsources].func = caller->func;
+
+	return &net_sources[net_numsources++];
+}
+
+static void
+NetCount(netcount_t *c, int bytes)
+{
+	c->count++;
+	c->bytes += bytes;
+}
+
+/*
+ * Same test as the servers SV_Multicast(),
+ * against the clients origin, not its view.
+ */
+static qboolean
+NetClientReceives(edict_t *ent, vec3_t origin, int to)
+{
+	switch (to)
+	{
+		case MULTICAST_PHS:
+		case MULTICAST_PHS_R:
+			return gi.inPHS(origin, ent->s.origin);
+		case MULTICAST_PVS:
+		case MULTICAST_PVS_R:
+			return gi.inPVS(origin, ent->s.origin);
+		default:
+			return true;
+	}
+}
+
+/*
+ * Books one message. client is the
+ * only receiver for unicasts, origin
+ * picks the receivers of multicasts.
+ */
+static void
+NetTally(int type, int te, int kind, int bytes, edict_t *client,
+		vec3_t origin)
+{
+	edict_t *ent;
+	int i;
+
+	NetCount(&net_types[type & 255], bytes);
+	NetCount(&net_kinds[kind], bytes);
+	NetCount(&NetSource()->c, bytes);
+	NetCount(&net_frame, bytes);
+	net_framekinds[kind] += bytes;
+
+	if ((te >= 0) && (te < NET_MAX_TEMPENTS))
+	{
+		NetCount(&net_tempents[te], bytes);
+	}
+
+	if (client)
+	{
+		i = client - g_edicts - 1;
+
+		if ((i >= 0) && (i < game.maxclients) && (i < MAX_CLIENTS))
+		{
+			NetCount(&net_clients[i], bytes);
+			net_frameclients[i] += bytes;
+		}
+
+		return;
+	}
+
+	for (i = 0; i < g_numclients; i++)
+	{
+		ent = g_clients[i];
+
+		if (origin && !NetClientReceives(ent, origin, kind))
+		{
+			continue;
+		}
+
+		NetCount(&net_clients[ent - g_edicts - 1], bytes);
+		net_frameclients[ent - g_edicts - 1] += bytes;
+	}
+}
+
+static void
+NetAdd(int bytes, int c, qboolean isbyte)
+{
+	if (net_msgbytes == 0)
+	{
+		net_msgtype = isbyte ? (c & 255) : NET_SVC_UNKNOWN;
+		net_msgte = -1;
+	}
+	else if ((net_msgbytes == 1) && isbyte && (net_msgtype == svc_temp_entity))
+	{
+		net_msgte = c & 255;
+	}
+
+	net_msgbytes += bytes;
+}
+
+static void
+NetFlush(int kind, edict_t *client, vec3_t origin)
+{
+	if (!net_msgbytes)
+	{
+		return;
+	}
+
+	NetTally(net_msgtype, net_msgte, kind, net_msgbytes, client, origin);
+	net_msgbytes = 0;
+}
+
+/* ====================================================================== */
+
+static void
+NetWriteChar(int c)
+{
+	NetAdd(1, c, true);
+	net_real.WriteChar(c);
+}
+
+static void
+NetWriteByte(int c)
+{
+	NetAdd(1, c, true);
+	net_real.WriteByte(c);
+}
+
+static void
+NetWriteShort(int c)
+{
+	NetAdd(2, c, false);
+	net_real.WriteShort(c);
+}
+
+static void
+NetWriteLong(int c)
+{
+	NetAdd(4, c, false);
+	net_real.WriteLong(c);
+}
+
+static void
+NetWriteFloat(float f)
+{
+	NetAdd(4, 0, false);
+	net_real.WriteFloat(f);
+}
+
+static void
+NetWriteString(char *s)
+{
+	NetAdd(s ? strlen(s) + 1 : 1, 0, false);
+	net_real.WriteString(s);
+}
+
+static void
+NetWritePosition(vec3_t pos)
+{
+	NetAdd(6, 0, false);
+	net_real.WritePosition(pos);
+}
+
+static void
+NetWriteDir(vec3_t dir)
+{
+	NetAdd(1, 0, false);
+	net_real.WriteDir(dir);
+}
+
+static void
+NetWriteAngle(float f)
+{
+	NetAdd(1, 0, false);
+	net_real.WriteAngle(f);
+}
+
+static void
+NetMulticast(vec3_t origin, multicast_t to)
+{
+	NetFlush(to, NULL, origin);
+	net_real.multicast(origin, to);
+}
+
+static void
+NetUnicast(edict_t *ent, qboolean reliable)
+{
+	NetFlush(reliable ? NK_UNICAST_R : NK_UNICAST, ent, NULL);
+	net_real.unicast(ent, reliable);
+}
+
+static void
+NetConfigstring(int num, char *string)
+{
+	/* svc, index, string */
+	NetTally(NET_SVC_CONFIGSTRING, -1, NK_CONFIGSTRING,
+			3 + (string ? strlen(string) + 1 : 1), NULL, NULL);
+	net_real.configstring(num, string);
+}
+
+static void
+NetBprintf(int printlevel, const char *fmt, ...)
+{
+	char msg[2048];
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	/* svc, level, string */
+	NetTally(NET_SVC_PRINT, -1, NK_PRINT, 3 + strlen(msg), NULL, NULL);
+	net_real.bprintf(printlevel, "%s", msg);
+}
+
+static void
+NetCprintf(edict_t *ent, int printlevel, const char *fmt, ...)
+{
+	char msg[2048];
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	/* NULL is the server console */
+	if (ent)
+	{
+		NetTally(NET_SVC_PRINT, -1, NK_PRINT, 3 + strlen(msg), ent, NULL);
+	}
+
+	net_real.cprintf(ent, printlevel, "%s", msg);
+}
+
+static void
+NetCenterprintf(edict_t *ent, const char *fmt, ...)
+{
+	char msg[1024];
+	va_list argptr;
+
+	va_start(argptr, fmt);
+	vsnprintf(msg, sizeof(msg), fmt, argptr);
+	va_end(argptr);
+
+	NetTally(NET_SVC_CENTERPRINT, -1, NK_CENTERPRINT, 2 + strlen(msg),
+			ent, NULL);
+	net_real.centerprintf(ent, "%s", msg);
+}
+
+static void
+NetWrap(qboolean on)
+{
+	net_msgbytes = 0;
+
+	if (on)
+	{
+		net_real = gi;
+
+		gi.WriteChar = NetWriteChar;
+		gi.WriteByte = NetWriteByte;
+		gi.WriteShort = NetWriteShort;
+		gi.WriteLong = NetWriteLong;
+		gi.WriteFloat = NetWriteFloat;
+		gi.WriteString = NetWriteString;
+		gi.WritePosition = NetWritePosition;
+		gi.WriteDir = NetWriteDir;
+		gi.WriteAngle = NetWriteAngle;
+		gi.multicast = NetMulticast;
+		gi.unicast = NetUnicast;
+		gi.configstring = NetConfigstring;
+		gi.bprintf = NetBprintf;
+		gi.cprintf = NetCprintf;
+		gi.centerprintf = NetCenterprintf;
+	}
+	else
+	{
+		gi.WriteChar = net_real.WriteChar;
+		gi.WriteByte = net_real.WriteByte;
+		gi.WriteShort = net_real.WriteShort;
+		gi.WriteLong = net_real.WriteLong;
+		gi.WriteFloat = net_real.WriteFloat;
+		gi.WriteString = net_real.WriteString;
+		gi.WritePosition = net_real.WritePosition;
+		gi.WriteDir = net_real.WriteDir;
+		gi.WriteAngle = net_real.WriteAngle;
+		gi.multicast = net_real.multicast;
+		gi.unicast = net_real.unicast;
+		gi.configstring = net_real.configstring;
+		gi.bprintf = net_real.bprintf;
+		gi.cprintf = net_real.cprintf;
+		gi.centerprintf = net_real.centerprintf;
+	}
+
+	net_wrapped = on;
+}
+
+static void
+NetCloseLog(void)
+{
+	if (net_log)
+	{
+		fclose(net_log);
+		net_log = NULL;
+	}
+}
+
+static void
+NetWriteLog(void)
+{
+	char name[MAX_OSPATH];
+	cvar_t *game_dir;
+	double maxclient;
+	int i;
+
+	if (!g_netlog->value)
+	{
+		NetCloseLog();
+		return;
+	}
+
+	if (net_log && strcmp(net_logmap, level.mapname))
+	{
+		NetCloseLog();
+	}
+
+	if (!net_log)
+	{
+		game_dir = gi.cvar("game", "", 0);
+		Com_sprintf(name, sizeof(name), "%s/netstats-%s.csv",
+				*game_dir->string ? game_dir->string : GAMEVERSION,
+				level.mapname);
+
+		if (!(net_log = Q_fopen(name, "w")))
+		{
+			gi.dprintf("Netstats: couldn't open %s\n", name);
+			gi.cvar_forceset("g_netlog", "0");
+			return;
+		}
+
+		Q_strlcpy(net_logmap, level.mapname, sizeof(net_logmap));
+		fprintf(net_log, "frame,messages,bytes,multicast,unicast,"
+				"configstring,print,clients,maxclient\n");
+	}
+
+	maxclient = 0;
+
+	for (i = 0; i < MAX_CLIENTS; i++)
+	{
+		if (net_frameclients[i] > maxclient)
+		{
+			maxclient = net_frameclients[i];
+		}
+	}
+
+	fprintf(net_log, "%i,%u,%.0f,%.0f,%.0f,%.0f,%.0f,%i,%.0f\n",
+			level.framenum, net_frame.count, net_frame.bytes,
+			net_framekinds[MULTICAST_ALL] + net_framekinds[MULTICAST_PHS] +
+			net_framekinds[MULTICAST_PVS] + net_framekinds[MULTICAST_ALL_R] +
+			net_framekinds[MULTICAST_PHS_R] + net_framekinds[MULTICAST_PVS_R],
+			net_framekinds[NK_UNICAST] + net_framekinds[NK_UNICAST_R],
+			net_framekinds[NK_CONFIGSTRING],
+			net_framekinds[NK_PRINT] + net_framekinds[NK_CENTERPRINT],
+			g_numclients, maxclient);
+}
+
+/* ====================================================================== */
+
+void
+G_NetStatsInit(void)
+{
+	g_netstats = gi.cvar("g_netstats", "0", 0);
+	g_netlog = gi.cvar("g_netlog", "0", 0);
+	g_effectcull = gi.cvar("g_effectcull", "0", 0);
+}
+
+void
+G_NetStatsShutdown(void)
+{
+	if (net_wrapped)
+	{
+		NetWrap(false);
+	}
+
+	NetCloseLog();
+}
+
+void
+G_NetStatsReset(void)
+{
+	memset(net_types, 0, sizeof(net_types));
+	memset(net_tempents, 0, sizeof(net_tempents));
+	memset(net_kinds, 0, sizeof(net_kinds));
+	memset(net_clients, 0, sizeof(net_clients));
+	memset(net_sources, 0, sizeof(net_sources));
+	memset(net_effects, 0, sizeof(net_effects));
+	memset(net_culled, 0, sizeof(net_culled));
+	memset(net_culledbytes, 0, sizeof(net_culledbytes));
+	net_numsources = 0;
+	net_frames = 0;
+}
+
+/*
+ * Called when a client was linked or the
+ * client list changed, the locations are
+ * collected again by the next effect.
+ */
+void
+G_EffectClientsMoved(void)
+{
+	net_locationsstale = true;
+}
+
+/*
+ * True if the box of a linked client lies in a
+ * single cluster and area. Its origin is in them
+ * too, so the server's test only depends on them.
+ */
+static qboolean
+NetSingleLocation(const edict_t *ent)
+{
+	return ent->area.prev && (ent->num_clusters == 1) && !ent->areanum2;
+}
+
+static void
+NetUpdateLocations(void)
+{
+	edict_t *ent, *other;
+	int i, j;
+
+	net_numlocations = 0;
+
+	for (i = 0; i < g_numclients; i++)
+	{
+		ent = g_clients[i];
+
+		for (j = 0; j < net_numlocations && NetSingleLocation(ent); j++)
+		{
+			other = net_locations[j];
+
+			if (NetSingleLocation(other) &&
+				(other->clusternums[0] == ent->clusternums[0]) &&
+				(other->areanum == ent->areanum))
+			{
+				break;
+			}
+		}
+
+		if (!NetSingleLocation(ent) || (j == net_numlocations))
+		{
+			net_locations[net_numlocations++] = ent;
+		}
+	}
+
+	net_locationsstale = false;
+}
+
+/*
+ * Returns false if no client can receive a multicast
+ * to origin, so effects can be dropped before their
+ * message is built. Clients sharing a cluster and an
+ * area are tested once. bytes is the size of the
+ * message, booked when it's dropped.
+ */
+qboolean
+G_EffectVisible(vec3_t origin, multicast_t to, int bytes)
+{
+	int i;
+
+	net_effects[to]++;
+
+	if (!g_effectcull->value)
+	{
+		return true;
+	}
+
+	if (net_locationsstale)
+	{
+		NetUpdateLocations();
+	}
+
+	for (i = 0; i < net_numlocations; i++)
+	{
+		if (NetClientReceives(net_locations[i], origin, to))
+		{
+			return true;
+		}
+	}
+
+	net_culled[to]++;
+	net_culledbytes[to] += bytes;
+
+	return false;
+}
+
+/*
+ * The entity the game is running for. Resets
+ * the callers pushed by G_NetStatsPush().
+ */
+void
+G_NetStatsSource(edict_t *ent)
+{
+	net_depth = 0;
+	net_callers[0].ent = ent;
+	net_callers[0].func = NULL;
+}
+
+/*
+ * Around think, touch and use calls, so
+ * their messages are booked on them.
+ */
+void
+G_NetStatsPush(edict_t *ent, void *func)
+{
+	if (++net_depth < NET_MAX_DEPTH)
+	{
+		net_callers[net_depth].ent = ent;
+		net_callers[net_depth].func = func;
+	}
+}
+
+void
+G_NetStatsPop(void)
+{
+	if (net_depth > 0)
+	{
+		net_depth--;
+	}
+}
+
+/*
+ * Called by G_RunFrame() once all messages of
+ * the frame are written. Turns the wrappers on
+ * or off and logs the frame.
+ */
+void
+G_NetStatsFrame(void)
+{
+	qboolean on;
+
+	on = (g_netstats->value != 0);
+
+	if (on != net_wrapped)
+	{
+		NetWrap(on);
+	}
+
+	if (!on)
+	{
+		NetCloseLog();
+		return;
+	}
+
+	net_frames++;
+	NetWriteLog();
+
+	memset(&net_frame, 0, sizeof(net_frame));
+	memset(net_framekinds, 0, sizeof(net_framekinds));
+	memset(net_frameclients, 0, sizeof(net_frameclients));
+	G_NetStatsSource(NULL);
+}
+
+static void
+NetPrintCount(const char *name, const netcount_t *c)
+{
+	gi.cprintf(NULL, PRINT_HIGH, "%-40s %9u %11.0f %9.1f\n", name, c->count,
+			c->bytes, net_frames ? c->bytes / net_frames : 0);
+}
+
+static int
+NetSourceCmp(const void *a, const void *b)
+{
+	const netsource_t *sa = a;
+	const netsource_t *sb = b;
+
+	if (sa->c.bytes != sb->c.bytes)
+	{
+		return (sa->c.bytes < sb->c.bytes) ? 1 : -1;
+	}
+
+	return 0;
+}
+
+void
+SVCmd_NetStats_f(void)
+{
+	functionList_t *func;
+	netcount_t total;
+	char name[64];
+	int i;
+
+	if (!Q_stricmp(gi.argv(2), "reset"))
+	{
+		G_NetStatsReset();
+		gi.cprintf(NULL, PRINT_HIGH, "Netstats cleared.\n");
+		return;
+	}
+
+	if (!net_wrapped)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Netstats are off, set g_netstats 1.\n");
+	}
+
+	memset(&total, 0, sizeof(total));
+
+	for (i = 0; i < NK_NUMKINDS; i++)
+	{
+		total.count += net_kinds[i].count;
+		total.bytes += net_kinds[i].bytes;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%u frames, %u messages, %.0f bytes\n\n",
+			net_frames, total.count, total.bytes);
+
+	for (i = 0; i <= MULTICAST_PVS_R; i++)
+	{
+		if (net_effects[i])
+		{
+			gi.cprintf(NULL, PRINT_HIGH,
+					"%-40s %9u effects, %u culled (%.1f%%), %.0f bytes\n",
+					net_kindnames[i], net_effects[i], net_culled[i],
+					100.0 * net_culled[i] / net_effects[i],
+					net_culledbytes[i]);
+		}
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	gi.cprintf(NULL, PRINT_HIGH, "%-40s %9s %11s %9s\n", "message", "count",
+			"bytes", "per frame");
+
+	for (i = 0; i < 256; i++)
+	{
+		if (!net_types[i].count)
+		{
+			continue;
+		}
+
+		if (i < sizeof(net_svcnames) / sizeof(net_svcnames[0]))
+		{
+			NetPrintCount(net_svcnames[i], &net_types[i]);
+		}
+		else
+		{
+			Com_sprintf(name, sizeof(name), "svc %i", i);
+			NetPrintCount(name, &net_types[i]);
+		}
+	}
+
+	for (i = 0; i < NET_MAX_TEMPENTS; i++)
+	{
+		if (net_tempents[i].count)
+		{
+			Com_sprintf(name, sizeof(name), "  temp_entity %i", i);
+			NetPrintCount(name, &net_tempents[i]);
+		}
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; i < NK_NUMKINDS; i++)
+	{
+		if (net_kinds[i].count)
+		{
+			NetPrintCount(net_kindnames[i], &net_kinds[i]);
+		}
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	/* the caller array is rebuilt as messages
+	   come in, so sorting it is fine */
+	qsort(net_sources, net_numsources, sizeof(net_sources[0]), NetSourceCmp);
+
+	for (i = 0; (i < net_numsources) && (i < 20); i++)
+	{
+		func = net_sources[i].func ?
+			   GetFunctionByAddress(net_sources[i].func) : NULL;
+
+		Com_sprintf(name, sizeof(name), "%s %s",
+				net_sources[i].classatom ?
+				G_ClassAtomName(net_sources[i].classatom) : "-",
+				func ? func->funcStr : "");
+		NetPrintCount(name, &net_sources[i].c);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "\n");
+
+	for (i = 0; (i < game.maxclients) && (i < MAX_CLIENTS); i++)
+	{
+		if (net_clients[i].count)
+		{
+			Com_sprintf(name, sizeof(name), "%2i %s", i,
+					game.clients[i].pers.netname);
+			NetPrintCount(name, &net_clients[i]);
+		}
+	}
+}
@@ -133,7 +133,9 @@ SV_RunThink(edict_t *ent)
 		gi.error("NULL ent->think");
 	}
 
+	G_NetStatsPush(ent, ent->think);
 	ent->think(ent);
+	G_NetStatsPop();
 
 	return false;
 }
@@ -156,12 +158,16 @@ SV_Impact(edict_t *e1, trace_t *trace)
 
 	if (e1->touch && (e1->solid != SOLID_NOT))
 	{
+		G_NetStatsPush(e1, e1->touch);
 		e1->touch(e1, e2, &trace->plane, trace->surface);
+		G_NetStatsPop();
 	}
 
 	if (e2->touch && (e2->solid != SOLID_NOT))
 	{
+		G_NetStatsPush(e2, e2->touch);
 		e2->touch(e2, e1, NULL, NULL);
+		G_NetStatsPop();
 	}
 }
 
@@ -547,8 +553,8 @@ retry:
 		   Everything else may break existing maps. Items
 		   may slide to unreachable locations, monsters may
 		   get stuck, etc. */
-		if (((strncmp(ent->classname, "monster_", 8) == 0) && ent->health < 1) ||
-				(strcmp(ent->classname, "debris") == 0) || (ent->s.effects & EF_GIB))
+		if (((ent->health < 1) && (strncmp(ent->classname, "monster_", 8) == 0)) ||
+				(G_ClassAtom(ent) == CN_debris) || (ent->s.effects & EF_GIB))
 		{
 			VectorAdd(ent->s.origin, trace.plane.normal, ent->s.origin);
 		}
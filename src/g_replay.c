@@ -0,0 +1,458 @@
+/*
+ * Copyright (C) 1997-2001 Id Software, Inc.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ * 02111-1307, USA.
+ *
+ * =======================================================================
+ *
+ * Deterministic replays. Records the usercmd_t of every ClientThink()
+ * and a hash of the world after every frame, so a later run of the
+ * same map can be fed the same input and checked frame by frame.
+ *
+ * =======================================================================
+ */
+
+/*
+ * Usage:
+ *
+ * g_seed <n>
+ *  Seeds all PRNG streams with n at every map start. 0 (the default)
+ *  doesn't reseed, the streams go on from where the last map left
+ *  them. They are seeded with 0 once, when the game is loaded.
+ *
+ * g_replay <0, 1 or 2>
+ *  0 disabled, 1 records, 2 plays back. Read at every map start,
+ *  the file is "replay-<mapname>.rpl" in the game directory.
+ *
+ * While playing back, the input of connected clients is ignored
+ * and replaced by the recorded one. Clients must be in the same
+ * slots as when recording. The first hash mismatch is reported,
+ * all are counted and printed when the replay ends.
+ *
+ * File format, little endian:
+ *  header: "KOIR", version (long), seed (long), mapname (MAX_QPATH)
+ *  'C' client (byte), msec, buttons (bytes), angles[3], forwardmove,
+ *      sidemove, upmove (shorts), impulse, lightlevel (bytes)
+ *  'F' framenum (long), hash (long)
+ */
+
+#include "header/local.h"
+
+#define REPLAY_MAGIC "KOIR"
+#define REPLAY_VERSION 3
+
+#define REPLAY_CMD 'C'
+#define REPLAY_FRAME 'F'
+
+#define REPLAY_OFF 0
+#define REPLAY_RECORD 1
+#define REPLAY_PLAY 2
+
+static cvar_t *g_seed;
+static cvar_t *g_replay;
+
+static FILE *replay_file;
+static int replay_mode;
+static qboolean replay_feeding; /* our own ClientThink() calls */
+
+static int replay_frames;
+static int replay_mismatches;
+
+/* ====================================================================== */
+
+static void
+ReplayWriteByte(int c)
+{
+	fputc(c & 0xff, replay_file);
+}
+
+static void
+ReplayWriteShort(int c)
+{
+	ReplayWriteByte(c);
+	ReplayWriteByte(c >> 8);
+}
+
+static void
+ReplayWriteLong(unsigned int c)
+{
+	ReplayWriteShort(c);
+	ReplayWriteShort(c >> 16);
+}
+
+static int
+ReplayReadByte(void)
+{
+	int c;
+
+	c = fgetc(replay_file);
+	return (c == EOF) ? -1 : c;
+}
+
+static short
+ReplayReadShort(void)
+{
+	int c;
+
+	c = ReplayReadByte() & 0xff;
+	c |= (ReplayReadByte() & 0xff) << 8;
+
+	return (short)c;
+}
+
+static unsigned int
+ReplayReadLong(void)
+{
+	unsigned int c;
+
+	c = (unsigned short)ReplayReadShort();
+	c |= (unsigned int)(unsigned short)ReplayReadShort() << 16;
+
+	return c;
+}
+
+/* ====================================================================== */
+
+static unsigned int
+ReplayHashBytes(unsigned int hash, const void *data, size_t size)
+{
+	const byte *p = data;
+
+	while (size--)
+	{
+		hash ^= *p++;
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
+/*
+ * Hash of what a player could notice: every entity
+ * position, animation and health, plus the players
+ * movement state.
+ */
+static unsigned int
+ReplayHashWorld(void)
+{
+	unsigned int hash = 2166136261u;
+	edict_t *ent;
+	int i;
+
+	hash = ReplayHashBytes(hash, &level.framenum, sizeof(level.framenum));
+
+	for (i = 0, ent = g_edicts; i < globals.num_edicts; i++, ent++)
+	{
+		if (!ent->inuse)
+		{
+			continue;
+		}
+
+		hash = ReplayHashBytes(hash, &i, sizeof(i));
+		hash = ReplayHashBytes(hash, ent->s.origin, sizeof(ent->s.origin));
+		hash = ReplayHashBytes(hash, ent->s.angles, sizeof(ent->s.angles));
+		hash = ReplayHashBytes(hash, &ent->s.frame, sizeof(ent->s.frame));
+		hash = ReplayHashBytes(hash, ent->velocity, sizeof(ent->velocity));
+		hash = ReplayHashBytes(hash, &ent->health, sizeof(ent->health));
+
+		if (ent->client)
+		{
+			hash = ReplayHashBytes(hash, &ent->client->ps.pmove,
+					sizeof(ent->client->ps.pmove));
+		}
+	}
+
+	return hash;
+}
+
+static void
+ReplayClose(void)
+{
+	if (!replay_file)
+	{
+		return;
+	}
+
+	fclose(replay_file);
+	replay_file = NULL;
+
+	if (replay_mode == REPLAY_PLAY)
+	{
+		gi.dprintf("Replay: %i frames played, %i mismatched\n",
+				replay_frames, replay_mismatches);
+	}
+	else
+	{
+		gi.dprintf("Replay: %i frames recorded\n", replay_frames);
+	}
+
+	replay_mode = REPLAY_OFF;
+}
+
+/* ====================================================================== */
+
+void
+G_ReplayInit(void)
+{
+	g_seed = gi.cvar("g_seed", "0", CVAR_LATCH);
+	g_replay = gi.cvar("g_replay", "0", CVAR_LATCH);
+}
+
+void
+G_ReplayShutdown(void)
+{
+	ReplayClose();
+}
+
+/*
+ * Called by SpawnEntities() before any entity
+ * is spawned, seeds the PRNG and starts the
+ * recording or play back of the new map.
+ */
+void
+G_ReplayBeginLevel(const char *mapname)
+{
+	char name[MAX_OSPATH];
+	char recorded_map[MAX_QPATH];
+	unsigned int seed;
+	cvar_t *game_dir;
+	int i;
+
+	ReplayClose();
+
+	/* not ->value, a float loses bits above 2^24 */
+	seed = (unsigned int)strtoul(g_seed->string, NULL, 0);
+	replay_mode = (int)g_replay->value;
+	replay_frames = 0;
+	replay_mismatches = 0;
+
+	if ((replay_mode != REPLAY_RECORD) && (replay_mode != REPLAY_PLAY))
+	{
+		replay_mode = REPLAY_OFF;
+
+		if (seed)
+		{
+			randk_seed(seed);
+		}
+
+		return;
+	}
+
+	game_dir = gi.cvar("game", "", 0);
+	Com_sprintf(name, sizeof(name), "%s/replay-%s.rpl",
+			*game_dir->string ? game_dir->string : GAMEVERSION, mapname);
+
+	if (replay_mode == REPLAY_RECORD)
+	{
+		if (!(replay_file = Q_fopen(name, "wb")))
+		{
+			gi.dprintf("Replay: couldn't open %s\n", name);
+			replay_mode = REPLAY_OFF;
+			return;
+		}
+
+		fwrite(REPLAY_MAGIC, 4, 1, replay_file);
+		ReplayWriteLong(REPLAY_VERSION);
+		ReplayWriteLong(seed);
+		Q_strlcpy(recorded_map, mapname, sizeof(recorded_map));
+		fwrite(recorded_map, sizeof(recorded_map), 1, replay_file);
+
+		gi.dprintf("Replay: recording %s, seed %u\n", name, seed);
+	}
+	else
+	{
+		char magic[4];
+
+		if (!(replay_file = Q_fopen(name, "rb")))
+		{
+			gi.dprintf("Replay: couldn't open %s\n", name);
+			replay_mode = REPLAY_OFF;
+			return;
+		}
+
+		if ((fread(magic, 4, 1, replay_file) != 1) ||
+			memcmp(magic, REPLAY_MAGIC, 4) ||
+			(ReplayReadLong() != REPLAY_VERSION))
+		{
+			gi.dprintf("Replay: %s is not a replay\n", name);
+			ReplayClose();
+			return;
+		}
+
+		/* the recorded seed wins */
+		seed = ReplayReadLong();
+
+		for (i = 0; i < MAX_QPATH; i++)
+		{
+			recorded_map[i] = ReplayReadByte();
+		}
+
+		recorded_map[MAX_QPATH - 1] = 0;
+
+		if (Q_stricmp(recorded_map, (char *)mapname))
+		{
+			gi.dprintf("Replay: %s was recorded on %s\n", name, recorded_map);
+			ReplayClose();
+			return;
+		}
+
+		gi.dprintf("Replay: playing %s, seed %u\n", name, seed);
+	}
+
+	/* always seed, a recording with seed 0
+	   still needs the PRNG at its start */
+	randk_seed(seed);
+}
+
+/*
+ * Called at the start of ClientThink(), returns
+ * true if the command should be dropped.
+ */
+qboolean
+G_ReplayClientThink(edict_t *ent, usercmd_t *ucmd)
+{
+	int i;
+
+	if (replay_mode == REPLAY_OFF)
+	{
+		return false;
+	}
+
+	if (replay_mode == REPLAY_PLAY)
+	{
+		/* live input is replaced by the recorded one */
+		return !replay_feeding;
+	}
+
+	ReplayWriteByte(REPLAY_CMD);
+	ReplayWriteByte(ent - g_edicts - 1);
+	ReplayWriteByte(ucmd->msec);
+	ReplayWriteByte(ucmd->buttons);
+
+	for (i = 0; i < 3; i++)
+	{
+		ReplayWriteShort(ucmd->angles[i]);
+	}
+
+	ReplayWriteShort(ucmd->forwardmove);
+	ReplayWriteShort(ucmd->sidemove);
+	ReplayWriteShort(ucmd->upmove);
+	ReplayWriteByte(ucmd->impulse);
+	ReplayWriteByte(ucmd->lightlevel);
+
+	return false;
+}
+
+/*
+ * Called by G_RunFrame() before running
+ * the world, feeds the recorded commands.
+ */
+void
+G_ReplayBeginFrame(void)
+{
+	usercmd_t ucmd;
+	edict_t *ent;
+	int type, i;
+
+	if (replay_mode != REPLAY_PLAY)
+	{
+		return;
+	}
+
+	while ((type = ReplayReadByte()) == REPLAY_CMD)
+	{
+		ent = g_edicts + 1 + ReplayReadByte();
+		ucmd.msec = ReplayReadByte();
+		ucmd.buttons = ReplayReadByte();
+
+		for (i = 0; i < 3; i++)
+		{
+			ucmd.angles[i] = ReplayReadShort();
+		}
+
+		ucmd.forwardmove = ReplayReadShort();
+		ucmd.sidemove = ReplayReadShort();
+		ucmd.upmove = ReplayReadShort();
+		ucmd.impulse = ReplayReadByte();
+		ucmd.lightlevel = ReplayReadByte();
+
+		if ((ent - g_edicts > game.maxclients) || !ent->inuse || !ent->client)
+		{
+			continue;
+		}
+
+		replay_feeding = true;
+		ClientThink(ent, &ucmd);
+		replay_feeding = false;
+	}
+
+	if (type != REPLAY_FRAME)
+	{
+		ReplayClose(); /* end of the recording */
+		return;
+	}
+
+	/* put the frame marker back for G_ReplayEndFrame() */
+	ungetc(type, replay_file);
+}
+
+/*
+ * Called by G_RunFrame() once the
+ * world ran, records or checks its hash.
+ */
+void
+G_ReplayEndFrame(void)
+{
+	unsigned int hash, recorded;
+	int framenum;
+
+	if (replay_mode == REPLAY_OFF)
+	{
+		return;
+	}
+
+	hash = ReplayHashWorld();
+	replay_frames++;
+
+	if (replay_mode == REPLAY_RECORD)
+	{
+		ReplayWriteByte(REPLAY_FRAME);
+		ReplayWriteLong(level.framenum);
+		ReplayWriteLong(hash);
+		return;
+	}
+
+	if (ReplayReadByte() != REPLAY_FRAME)
+	{
+		ReplayClose();
+		return;
+	}
+
+	/* read both, the next record follows */
+	framenum = (int)ReplayReadLong();
+	recorded = ReplayReadLong();
+
+	if ((framenum != level.framenum) || (recorded != hash))
+	{
+		if (!replay_mismatches)
+		{
+			gi.dprintf("Replay: first mismatch at frame %i\n", level.framenum);
+		}
+
+		replay_mismatches++;
+	}
+}
@@ -330,6 +330,7 @@ ED_CallSpawn(edict_t *ent)
 		if (!strcmp(item->classname, ent->classname))
 		{
 			/* found it */
+			G_ClassAtom(ent);
 			SpawnItem(ent, item);
 			return;
 		}
@@ -341,6 +342,7 @@ ED_CallSpawn(edict_t *ent)
 		if (!strcmp(s->name, ent->classname))
 		{
 			/* found it */
+			G_ClassAtom(ent);
 			s->spawn(ent);
 			return;
 		}
@@ -534,17 +536,38 @@ ED_ParseEdict(char *data, edict_t *ent)
  *
  * All but the first will have the FL_TEAMSLAVE flag set.
  * All but the last will have the teamchain field set to the next one
+ *
+ * Teams are looked up in a hash, so this is one pass
+ * over the edicts. Since the edicts are walked in order,
+ * the master is the first of its team and the chain
+ * follows the edict order.
  */
+typedef struct
+{
+	edict_t *master;
+	edict_t *last;
+} teamslot_t;
+
 void
 G_FindTeams(void)
 {
-	edict_t *e, *e2, *chain;
-	int i, j;
+	teamslot_t *slots, *slot;
+	unsigned int size, h;
+	edict_t *e;
+	int i;
 	int c, c2;
 
 	c = 0;
 	c2 = 0;
 
+	/* at least twice the edicts, power of two */
+	for (size = 64; size < 2 * globals.num_edicts; size <<= 1)
+	{
+	}
+
+	slots = gi.TagMalloc(size * sizeof(*slots), TAG_LEVEL);
+	memset(slots, 0, size * sizeof(*slots));
+
 	for (i = 1, e = g_edicts + i; i < globals.num_edicts; i++, e++)
 	{
 		if (!e->inuse)
@@ -562,42 +585,72 @@ G_FindTeams(void)
 			continue;
 		}
 
-		chain = e;
-		e->teammaster = e;
-		c++;
-		c2++;
-
-		for (j = i + 1, e2 = e + 1; j < globals.num_edicts; j++, e2++)
+		/* linear probing */
+		for (h = Q_strhash(e->team) & (size - 1); ; h = (h + 1) & (size - 1))
 		{
-			if (!e2->inuse)
-			{
-				continue;
-			}
+			slot = &slots[h];
 
-			if (!e2->team)
+			if (!slot->master || !strcmp(slot->master->team, e->team))
 			{
-				continue;
-			}
-
-			if (e2->flags & FL_TEAMSLAVE)
-			{
-				continue;
+				break;
 			}
+		}
 
-			if (!strcmp(e->team, e2->team))
-			{
-				c2++;
-				chain->teamchain = e2;
-				e2->teammaster = e;
-				chain = e2;
-				e2->flags |= FL_TEAMSLAVE;
-			}
+		if (!slot->master)
+		{
+			slot->master = e;
+			slot->last = e;
+			e->teammaster = e;
+			c++;
+			c2++;
+			continue;
 		}
+
+		c2++;
+		slot->last->teamchain = e;
+		e->teammaster = slot->master;
+		slot->last = e;
+		e->flags |= FL_TEAMSLAVE;
 	}
 
+	gi.TagFree(slots);
+
 	gi.dprintf("%i teams with %i entities.\n", c, c2);
 }
 
+/*
+ * Classes that are never linked or sent
+ * to clients and only think, get used or
+ * are found by their targetname. They are
+ * spawned as logic entities.
+ */
+static qboolean
+ED_IsLogic(edict_t *ent)
+{
+	switch (G_ClassAtom(ent))
+	{
+		case CN_func_timer:
+		case CN_info_notnull:
+		case CN_info_player_coop:
+		case CN_info_player_intermission:
+		case CN_info_player_start:
+		case CN_light:
+		case CN_target_changelevel:
+		case CN_target_crosslevel_target:
+		case CN_target_crosslevel_trigger:
+		case CN_target_explosion:
+		case CN_target_help:
+		case CN_target_lightramp:
+		case CN_target_spawner:
+		case CN_target_temp_entity:
+		case CN_trigger_always:
+		case CN_trigger_relay:
+			return true;
+		default:
+			return false;
+	}
+}
+
 /*
  * Creates a server's entity / program execution context by
  * parsing textual entity definitions out of an ent file.
@@ -606,16 +659,19 @@ void
 SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 {
 	edict_t *ent;
-	int inhibit;
+	int inhibit, logic;
 	const char *com_token;
 	int i;
 	float skill_level;
+	clock_t start, teams;
 
 	if (!mapname || !entities || !spawnpoint)
 	{
 		return;
 	}
 
+	start = clock();
+
 	skill_level = floor(skill->value);
 
 	if (skill_level < 0)
@@ -636,6 +692,12 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 	SaveClientData();
 
 	gi.FreeTags(TAG_LEVEL);
+	G_ClearTargetGraph();
+	G_ClearDelayedUses();
+	G_ClearPierceCache();
+	G_ClearTriggerCache();
+	G_ClearInfoPools();
+	G_ClearLogicEdicts();
 
 	memset(&level, 0, sizeof(level));
 	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
@@ -643,14 +705,20 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 	Q_strlcpy(level.mapname, mapname, sizeof(level.mapname));
 	Q_strlcpy(game.spawnpoint, spawnpoint, sizeof(game.spawnpoint));
 
+	/* seeds the PRNG before anything is spawned */
+	G_ReplayBeginLevel(mapname);
+
 	/* set client fields on player ents */
 	for (i = 0; i < game.maxclients; i++)
 	{
 		g_edicts[i + 1].client = game.clients + i;
 	}
 
+	G_UpdateClientList();
+
 	ent = NULL;
 	inhibit = 0;
+	logic = 0;
 
 	/* parse ents */
 	while (1)
@@ -721,16 +789,31 @@ SpawnEntities(const char *mapname, char *entities, const char *spawnpoint)
 				~(SPAWNFLAG_NOT_EASY | SPAWNFLAG_NOT_MEDIUM |
 				  SPAWNFLAG_NOT_HARD |
 				  SPAWNFLAG_NOT_COOP | SPAWNFLAG_NOT_DEATHMATCH);
+
+			/* hands the slot back */
+			if (ED_IsLogic(ent))
+			{
+				ent = G_MoveToLogic(ent);
+				logic++;
+			}
 		}
 
 		ED_CallSpawn(ent);
 	}
 
 	gi.dprintf("%i entities inhibited.\n", inhibit);
+	gi.dprintf("%i logic entities.\n", logic);
 
+	teams = clock();
 	G_FindTeams();
+	G_CacheDeathmatchSpots();
+	G_BuildTargetGraph();
 
 	PlayerTrail_Init();
+
+	gi.dprintf("Spawned in %.1f ms, teams in %.1f ms.\n",
+			(clock() - start) * 1000.0 / CLOCKS_PER_SEC,
+			(clock() - teams) * 1000.0 / CLOCKS_PER_SEC);
 }
 
 /* =================================================================== */
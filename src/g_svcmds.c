@@ -24,9 +24,9 @@
  * =======================================================================
  */
 
-#include "header/local.h"
+#include <ctype.h>
 
-#define MAX_IPFILTERS 1024
+#include "header/local.h"
 
 void
 Svcmd_Test_f(void)
@@ -45,9 +45,12 @@ Svcmd_Test_f(void)
  * addip <ip>
  * removeip <ip>
  *
- * The ip address is specified in dot format, and any unspecified
- * digits will match any value, so you can specify an entire class
- * C network with "addip 192.246.40".
+ * The ip address is specified in dot format for IPv4 or colon
+ * format for IPv6, optionally followed by a CIDR prefix length:
+ * "addip 192.246.40.0/24", "addip 2001:db8::/32". Without a prefix
+ * length trailing zero or missing IPv4 digits match any value, so
+ * you can still specify an entire class C network with
+ * "addip 192.246.40".
  *
  * Removeip will only remove an address specified exactly the same
  * way. You cannot addip a subnet, then removeip a single host.
@@ -60,6 +63,11 @@ Svcmd_Test_f(void)
  *  at a later date. The filter lists are not saved and restored
  *  by default, because I belive it would cause too much confusion.
  *
+ * loadip [file]
+ *  Reads listip.cfg or the given file from the game directory
+ *  directly, much faster than execing it. Takes "sv addip" lines
+ *  as written by writeip, or one address per line.
+ *
  * filterban <0 or 1>
  *  If 1 (the default), then ip addresses matching the current list
  *  will be prohibited from entering the game.This is the default
@@ -68,272 +76,1213 @@ Svcmd_Test_f(void)
  *  This lets you easily set up a private game, or a game that only
  *  allows players from your local network.
  *
+ * The filters are kept in a path compressed binary trie over the
+ * 128 address bits, IPv4 is stored as IPv4-mapped IPv6
+ * (::ffff:a.b.c.d). There are at most two nodes per filter and a
+ * lookup walks at most one node per filter prefix it passes, no
+ * matter how many filters there are.
+ *
  * ==============================================================================
  */
 
 typedef struct
 {
-	unsigned mask;
-	unsigned compare;
+	byte addr[16];
+	int bits; /* prefix length */
 } ipfilter_t;
 
-static ipfilter_t ipfilters[MAX_IPFILTERS];
-static int numipfilters;
+typedef struct
+{
+	byte key[16]; /* only the first bits count */
+	int bits;
+	int child[2]; /* 0 is none, the root is never a child */
+	qboolean match; /* a filter ends here */
+} ipnode_t;
 
-static qboolean
-StringToFilter(char *s, ipfilter_t *f)
+typedef struct
 {
-	char num[128];
-	int i, j;
-	YQ2_ALIGNAS_TYPE(unsigned) byte b[4];
-	YQ2_ALIGNAS_TYPE(unsigned) byte m[4];
+	ipnode_t *nodes;
+	int numnodes;
+	int maxnodes;
 
-	if (!s || !f)
+	ipfilter_t *filters; /* for listing, in the order added */
+	int numfilters;
+	int maxfilters;
+} iptrie_t;
+
+static iptrie_t ipfilters;
+
+static const byte ipv4_mapped[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff};
+
+/* ---------------------------------------------------------------------------- */
+
+static int
+IPBit(const byte *addr, int bit)
+{
+	return (addr[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+/*
+ * Number of leading bits a and b have
+ * in common, at most max.
+ */
+static int
+IPCommonBits(const byte *a, const byte *b, int max)
+{
+	int i, bits;
+	byte x;
+
+	for (i = 0, bits = 0; bits < max; i++, bits += 8)
 	{
-		return false;
+		if ((x = a[i] ^ b[i]))
+		{
+			while (!(x & 0x80))
+			{
+				x <<= 1;
+				bits++;
+			}
+
+			break;
+		}
 	}
 
-	for (i = 0; i < 4; i++)
+	return (bits < max) ? bits : max;
+}
+
+static void *
+IPRealloc(void *p, size_t size)
+{
+	if (!(p = realloc(p, size)))
 	{
-		b[i] = 0;
-		m[i] = 0;
+		gi.error("IP filters: out of memory for %u bytes", (unsigned int)size);
 	}
 
-	for (i = 0; i < 4; i++)
+	return p;
+}
+
+static int
+IPTrieNewNode(iptrie_t *t, const byte *key, int bits)
+{
+	ipnode_t *node;
+
+	if (t->numnodes == t->maxnodes)
+	{
+		t->maxnodes = t->maxnodes ? t->maxnodes * 2 : 256;
+		t->nodes = IPRealloc(t->nodes, t->maxnodes * sizeof(*t->nodes));
+	}
+
+	node = &t->nodes[t->numnodes];
+	memset(node, 0, sizeof(*node));
+	memcpy(node->key, key, sizeof(node->key));
+	node->bits = bits;
+
+	return t->numnodes++;
+}
+
+/*
+ * Returns the node at the end of the filters
+ * prefix, NULL if there's none and create is
+ * false. The trie is path compressed, a node
+ * stands for all bits up to its own length,
+ * so there are at most two nodes per filter.
+ */
+static ipnode_t *
+IPTrieFind(iptrie_t *t, const ipfilter_t *f, qboolean create)
+{
+	int n, c, m, bit, common;
+
+	if (!t->numnodes)
 	{
-		if ((*s < '0') || (*s > '9'))
+		if (!create)
 		{
-			gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
-			return false;
+			return NULL;
 		}
 
-		j = 0;
+		IPTrieNewNode(t, f->addr, 0);
+	}
+
+	for (n = 0; t->nodes[n].bits < f->bits; n = c)
+	{
+		bit = IPBit(f->addr, t->nodes[n].bits);
 
-		while (*s >= '0' && *s <= '9')
+		if (!(c = t->nodes[n].child[bit]))
 		{
-			num[j++] = *s++;
+			if (!create)
+			{
+				return NULL;
+			}
+
+			/* may move the nodes */
+			c = IPTrieNewNode(t, f->addr, f->bits);
+			t->nodes[n].child[bit] = c;
+
+			return &t->nodes[c];
 		}
 
-		num[j] = 0;
-		b[i] = (int)strtol(num, (char **)NULL, 10);
+		common = IPCommonBits(f->addr, t->nodes[c].key,
+				(t->nodes[c].bits < f->bits) ? t->nodes[c].bits : f->bits);
 
-		if (b[i] != 0)
+		if (common == t->nodes[c].bits)
 		{
-			m[i] = 255;
+			continue;
 		}
 
-		if (!*s)
+		if (!create)
 		{
-			break;
+			return NULL;
 		}
 
-		s++;
-	}
+		/* split the edge where the filter leaves it */
+		m = IPTrieNewNode(t, f->addr, common);
+		t->nodes[m].child[IPBit(t->nodes[c].key, common)] = c;
+		t->nodes[n].child[bit] = m;
 
-	f->mask = *(unsigned *)m;
-	f->compare = *(unsigned *)b;
+		if (common == f->bits)
+		{
+			return &t->nodes[m];
+		}
 
-	return true;
+		c = IPTrieNewNode(t, f->addr, f->bits);
+		t->nodes[m].child[IPBit(f->addr, common)] = c;
+
+		return &t->nodes[c];
+	}
+
+	return &t->nodes[n];
 }
 
-qboolean
-SV_FilterPacket(char *from)
+/*
+ * Returns false if the filter is already there.
+ */
+static qboolean
+IPTrieAdd(iptrie_t *t, const ipfilter_t *f)
 {
-	int i;
-	unsigned in;
-	YQ2_ALIGNAS_TYPE(unsigned) byte m[4];
-	char *p;
+	ipnode_t *node;
 
-	if (!from)
+	node = IPTrieFind(t, f, true);
+
+	if (node->match)
 	{
 		return false;
 	}
 
-	i = 0;
-	p = from;
+	node->match = true;
 
-	while (*p && i < 4)
+	if (t->numfilters == t->maxfilters)
 	{
-		m[i] = 0;
+		t->maxfilters = t->maxfilters ? t->maxfilters * 2 : 64;
+		t->filters = IPRealloc(t->filters, t->maxfilters * sizeof(*t->filters));
+	}
 
-		while (*p >= '0' && *p <= '9')
-		{
-			m[i] = m[i] * 10 + (*p - '0');
-			p++;
-		}
+	t->filters[t->numfilters++] = *f;
 
-		if (!*p || (*p == ':'))
-		{
-			break;
-		}
+	return true;
+}
 
-		i++, p++;
+/*
+ * Returns false if there's no such filter. The
+ * nodes stay, they're reused if it's added again.
+ */
+static qboolean
+IPTrieRemove(iptrie_t *t, const ipfilter_t *f)
+{
+	ipnode_t *node;
+	int i;
+
+	node = IPTrieFind(t, f, false);
+
+	if (!node || !node->match)
+	{
+		return false;
 	}
 
-	in = *(unsigned *)m;
+	node->match = false;
 
-	for (i = 0; i < numipfilters; i++)
+	for (i = 0; i < t->numfilters; i++)
 	{
-		if ((in & ipfilters[i].mask) == ipfilters[i].compare)
+		if ((t->filters[i].bits == f->bits) &&
+			!memcmp(t->filters[i].addr, f->addr, sizeof(f->addr)))
 		{
-			return (int)filterban->value;
+			memmove(&t->filters[i], &t->filters[i + 1],
+					(t->numfilters - i - 1) * sizeof(t->filters[0]));
+			t->numfilters--;
+			break;
 		}
 	}
 
-	return (int)!filterban->value;
+	return true;
 }
 
-void
-SVCmd_AddIP_f(void)
+static qboolean
+IPTrieMatch(const iptrie_t *t, const byte *addr)
 {
-	int i;
+	const ipnode_t *node;
+	int n;
 
-	if (gi.argc() < 3)
+	if (!t->numnodes)
 	{
-		gi.cprintf(NULL, PRINT_HIGH, "Usage:  addip <ip-mask>\n");
-		return;
+		return false;
 	}
 
-	for (i = 0; i < numipfilters; i++)
+	for (node = t->nodes; ; node = &t->nodes[n])
 	{
-		if (ipfilters[i].compare == 0xffffffff)
+		if (node->match)
 		{
-			break; /* free spot */
+			return true;
 		}
-	}
 
-	if (i == numipfilters)
-	{
-		if (numipfilters == MAX_IPFILTERS)
+		if ((node->bits == 128) || !(n = node->child[IPBit(addr, node->bits)]))
 		{
-			gi.cprintf(NULL, PRINT_HIGH, "IP filter list is full\n");
-			return;
+			return false;
 		}
 
-		numipfilters++;
+		/* the skipped bits must match too */
+		if (IPCommonBits(addr, t->nodes[n].key, t->nodes[n].bits) != t->nodes[n].bits)
+		{
+			return false;
+		}
 	}
+}
 
-	if (!StringToFilter(gi.argv(2), &ipfilters[i]))
-	{
-		ipfilters[i].compare = 0xffffffff;
-	}
+static void
+IPTrieFree(iptrie_t *t)
+{
+	free(t->nodes);
+	free(t->filters);
+	memset(t, 0, sizeof(*t));
 }
 
-void
-SVCmd_RemoveIP_f(void)
+/* ---------------------------------------------------------------------------- */
+
+/*
+ * Parses up to 4 dotted decimal numbers, returns
+ * how many were found or 0 on error.
+ */
+static int
+ParseIPv4(const char **s, byte *out)
 {
-	ipfilter_t f;
-	int i, j;
+	const char *p = *s;
+	int i, n;
 
-	if (gi.argc() < 3)
+	for (i = 0; i < 4; i++)
 	{
-		gi.cprintf(NULL, PRINT_HIGH, "Usage:  sv removeip <ip-mask>\n");
-		return;
+		if ((*p < '0') || (*p > '9'))
+		{
+			return 0;
+		}
+
+		for (n = 0; (*p >= '0') && (*p <= '9'); p++)
+		{
+			n = n * 10 + (*p - '0');
+
+			if (n > 255)
+			{
+				return 0;
+			}
+		}
+
+		out[i] = n;
+
+		if ((*p != '.') || (i == 3))
+		{
+			i++;
+			break;
+		}
+
+		p++;
 	}
 
-	if (!StringToFilter(gi.argv(2), &f))
+	*s = p;
+
+	return i;
+}
+
+static qboolean
+ParseIPv6(const char **s, byte *out)
+{
+	const char *p = *s;
+	const char *q;
+	byte groups[16];
+	int num, gap, n, digits;
+
+	num = 0;
+	gap = -1;
+
+	if ((p[0] == ':') && (p[1] == ':'))
 	{
-		return;
+		gap = 0;
+		p += 2;
 	}
 
-	for (i = 0; i < numipfilters; i++)
+	while (num < 16)
 	{
-		if ((ipfilters[i].mask == f.mask) &&
-			(ipfilters[i].compare == f.compare))
+		/* an embedded IPv4 address ends it */
+		for (q = p; isxdigit((unsigned char)*q); q++)
+		{
+		}
+
+		if ((*q == '.') && (num <= 12))
 		{
-			for (j = i + 1; j < numipfilters; j++)
+			if (ParseIPv4(&p, groups + num) != 4)
 			{
-				ipfilters[j - 1] = ipfilters[j];
+				return false;
 			}
 
-			numipfilters--;
-			gi.cprintf(NULL, PRINT_HIGH, "Removed.\n");
-			return;
+			num += 4;
+			break;
 		}
-	}
 
-	gi.cprintf(NULL, PRINT_HIGH, "Didn't find %s.\n", gi.argv(2));
-}
+		for (n = 0, digits = 0; isxdigit((unsigned char)*p) && (digits < 4);
+			 p++, digits++)
+		{
+			n = n * 16 + (isdigit((unsigned char)*p) ? *p - '0' :
+					tolower((unsigned char)*p) - 'a' + 10);
+		}
 
-void
-SVCmd_ListIP_f(void)
-{
-	int i;
-	YQ2_ALIGNAS_TYPE(unsigned) byte b[4];
+		if (!digits)
+		{
+			/* "::" at the end */
+			if ((gap == num) && (num > 0 || p == *s + 2))
+			{
+				break;
+			}
 
-	gi.cprintf(NULL, PRINT_HIGH, "Filter list:\n");
+			return false;
+		}
+
+		groups[num++] = n >> 8;
+		groups[num++] = n & 0xff;
+
+		if (*p != ':')
+		{
+			break;
+		}
+
+		p++;
+
+		if (*p == ':')
+		{
+			if (gap >= 0)
+			{
+				return false;
+			}
+
+			gap = num;
+			p++;
+
+			if (!isxdigit((unsigned char)*p))
+			{
+				break;
+			}
+		}
+	}
+
+	if (gap < 0)
+	{
+		if (num != 16)
+		{
+			return false;
+		}
 
-	for (i = 0; i < numipfilters; i++)
+		memcpy(out, groups, 16);
+	}
+	else
 	{
-		*(unsigned *)b = ipfilters[i].compare;
-		gi.cprintf(NULL, PRINT_HIGH, "%3i.%3i.%3i.%3i\n", b[0],
-				b[1], b[2], b[3]);
+		if (num > 14)
+		{
+			return false;
+		}
+
+		memset(out, 0, 16);
+		memcpy(out, groups, gap);
+		memcpy(out + 16 - (num - gap), groups + gap, num - gap);
 	}
+
+	*s = p;
+
+	return true;
 }
 
-void
-SVCmd_WriteIP_f(void)
+/*
+ * Parses "<ip>[/<bits>]", IPv4 or IPv6.
+ */
+static qboolean
+StringToFilter(const char *s, ipfilter_t *f)
 {
-	FILE *f;
-	char name[MAX_OSPATH];
-	YQ2_ALIGNAS_TYPE(unsigned) byte b[4];
-	int i;
-	cvar_t *game;
+	const char *p = s;
+	byte b[4] = {0};
+	int num, i;
 
-	game = gi.cvar("game", "", 0);
+	if (!s || !f)
+	{
+		return false;
+	}
 
-	if (!*game->string)
+	memset(f, 0, sizeof(*f));
+
+	if (strchr(s, ':'))
 	{
-		sprintf(name, "%s/listip.cfg", GAMEVERSION);
+		if (!ParseIPv6(&p, f->addr))
+		{
+			goto bad;
+		}
+
+		f->bits = 128;
 	}
 	else
 	{
-		sprintf(name, "%s/listip.cfg", game->string);
-	}
+		if (!(num = ParseIPv4(&p, b)))
+		{
+			goto bad;
+		}
 
-	gi.cprintf(NULL, PRINT_HIGH, "Writing %s.\n", name);
+		/* zero or missing trailing digits match anything */
+		for (i = num; i > 0 && !b[i - 1]; i--)
+		{
+		}
 
-	f = Q_fopen(name, "wb");
+		memcpy(f->addr, ipv4_mapped, sizeof(ipv4_mapped));
+		memcpy(f->addr + 12, b, 4);
+		f->bits = 96 + i * 8;
+	}
 
-	if (!f)
+	if (*p == '/')
 	{
-		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
-		return;
+		p++;
+
+		if ((*p < '0') || (*p > '9'))
+		{
+			goto bad;
+		}
+
+		i = (int)strtol(p, (char **)&p, 10);
+
+		/* IPv4 lengths count from the mapped prefix */
+		if (!strchr(s, ':'))
+		{
+			i += 96;
+		}
+
+		if (i > 128)
+		{
+			goto bad;
+		}
+
+		f->bits = i;
 	}
 
-	fprintf(f, "set filterban %d\n", (int)filterban->value);
+	if (*p)
+	{
+		goto bad;
+	}
 
-	for (i = 0; i < numipfilters; i++)
+	/* clear the host bits, so equal ranges compare equal */
+	for (i = f->bits; i < 128; i++)
 	{
-		*(unsigned *)b = ipfilters[i].compare;
-		fprintf(f, "sv addip %i.%i.%i.%i\n", b[0], b[1], b[2], b[3]);
+		f->addr[i >> 3] &= ~(0x80 >> (i & 7));
 	}
 
-	fclose(f);
+	return true;
+
+bad:
+	gi.cprintf(NULL, PRINT_HIGH, "Bad filter address: %s\n", s);
+	return false;
 }
 
 /*
- * ServerCommand will be called when an "sv" command is issued.
- * The game can issue gi.argc() / gi.argv() commands to get the rest
- * of the parameters
+ * Parses a client address as the server puts it
+ * in the "ip" userinfo key: "a.b.c.d:port" or
+ * "[v6]:port". Anything else ("loopback") fails.
  */
-void
-ServerCommand(void)
+static qboolean
+StringToAddress(const char *s, byte *addr)
 {
-	char *cmd;
-
-	cmd = gi.argv(1);
+	const char *p = s;
 
-	if (Q_stricmp(cmd, "test") == 0)
+	if (*p == '[')
 	{
-		Svcmd_Test_f();
+		p++;
+		return ParseIPv6(&p, addr) && (*p == ']');
 	}
-	else if (Q_stricmp(cmd, "addip") == 0)
+
+	if (strchr(s, '.') && (!strchr(s, ':') || (strchr(s, '.') < strchr(s, ':'))))
 	{
-		SVCmd_AddIP_f();
+		memcpy(addr, ipv4_mapped, sizeof(ipv4_mapped));
+		return (ParseIPv4(&p, addr + 12) == 4) && (!*p || (*p == ':'));
 	}
-	else if (Q_stricmp(cmd, "removeip") == 0)
-	{
+
+	return ParseIPv6(&p, addr) && !*p;
+}
+
+static void
+FilterToString(const ipfilter_t *f, char *out, size_t size)
+{
+	int i, best, bestlen, len;
+	char *o = out;
+
+	if ((f->bits >= 96) && !memcmp(f->addr, ipv4_mapped, sizeof(ipv4_mapped)))
+	{
+		if (f->bits == 128)
+		{
+			Com_sprintf(out, size, "%i.%i.%i.%i", f->addr[12], f->addr[13],
+					f->addr[14], f->addr[15]);
+		}
+		else
+		{
+			Com_sprintf(out, size, "%i.%i.%i.%i/%i", f->addr[12], f->addr[13],
+					f->addr[14], f->addr[15], f->bits - 96);
+		}
+
+		return;
+	}
+
+	/* the longest run of zero groups becomes "::" */
+	best = -1;
+	bestlen = 1;
+
+	for (i = 0; i < 8; i += len ? len : 1)
+	{
+		for (len = 0; (i + len < 8) && !f->addr[(i + len) * 2] &&
+			 !f->addr[(i + len) * 2 + 1]; len++)
+		{
+		}
+
+		if (len > bestlen)
+		{
+			best = i;
+			bestlen = len;
+		}
+	}
+
+	*o = 0;
+
+	for (i = 0; i < 8; i++)
+	{
+		if (i == best)
+		{
+			Q_strlcat(out, (i == 0) ? "::" : ":", size);
+			i += bestlen - 1;
+			continue;
+		}
+
+		Q_strlcat(out, va("%x%s", (f->addr[i * 2] << 8) | f->addr[i * 2 + 1],
+					(i < 7) ? ":" : ""), size);
+	}
+
+	if (f->bits < 128)
+	{
+		Q_strlcat(out, va("/%i", f->bits), size);
+	}
+}
+
+/* ---------------------------------------------------------------------------- */
+
+qboolean
+SV_FilterPacket(char *from)
+{
+	byte addr[16];
+
+	if (!from)
+	{
+		return false;
+	}
+
+	if (StringToAddress(from, addr) && IPTrieMatch(&ipfilters, addr))
+	{
+		return (int)filterban->value;
+	}
+
+	return (int)!filterban->value;
+}
+
+void
+SVCmd_AddIP_f(void)
+{
+	ipfilter_t f;
+
+	if (gi.argc() < 3)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage:  addip <ip-mask>\n");
+		return;
+	}
+
+	if (StringToFilter(gi.argv(2), &f))
+	{
+		IPTrieAdd(&ipfilters, &f);
+	}
+}
+
+void
+SVCmd_RemoveIP_f(void)
+{
+	ipfilter_t f;
+
+	if (gi.argc() < 3)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Usage:  sv removeip <ip-mask>\n");
+		return;
+	}
+
+	if (!StringToFilter(gi.argv(2), &f))
+	{
+		return;
+	}
+
+	if (IPTrieRemove(&ipfilters, &f))
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Removed.\n");
+		return;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "Didn't find %s.\n", gi.argv(2));
+}
+
+void
+SVCmd_ListIP_f(void)
+{
+	char buf[64];
+	int i;
+
+	gi.cprintf(NULL, PRINT_HIGH, "Filter list:\n");
+
+	for (i = 0; i < ipfilters.numfilters; i++)
+	{
+		FilterToString(&ipfilters.filters[i], buf, sizeof(buf));
+		gi.cprintf(NULL, PRINT_HIGH, "%s\n", buf);
+	}
+}
+
+static void
+IPFilterFileName(char *name, size_t size, const char *file)
+{
+	cvar_t *game;
+
+	game = gi.cvar("game", "", 0);
+
+	if (!*game->string)
+	{
+		Com_sprintf(name, size, "%s/%s", GAMEVERSION, file);
+	}
+	else
+	{
+		Com_sprintf(name, size, "%s/%s", game->string, file);
+	}
+}
+
+void
+SVCmd_WriteIP_f(void)
+{
+	FILE *f;
+	char name[MAX_OSPATH];
+	char buf[64];
+	int i;
+
+	IPFilterFileName(name, sizeof(name), "listip.cfg");
+
+	gi.cprintf(NULL, PRINT_HIGH, "Writing %s.\n", name);
+
+	f = Q_fopen(name, "wb");
+
+	if (!f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
+		return;
+	}
+
+	fprintf(f, "set filterban %d\n", (int)filterban->value);
+
+	for (i = 0; i < ipfilters.numfilters; i++)
+	{
+		FilterToString(&ipfilters.filters[i], buf, sizeof(buf));
+		fprintf(f, "sv addip %s\n", buf);
+	}
+
+	fclose(f);
+}
+
+void
+SVCmd_LoadIP_f(void)
+{
+	FILE *f;
+	char name[MAX_OSPATH];
+	char line[256];
+	char *s, *e;
+	int added, bad;
+	ipfilter_t filter;
+
+	IPFilterFileName(name, sizeof(name),
+			(gi.argc() > 2) ? gi.argv(2) : "listip.cfg");
+
+	f = Q_fopen(name, "rb");
+
+	if (!f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", name);
+		return;
+	}
+
+	added = 0;
+	bad = 0;
+
+	while (fgets(line, sizeof(line), f))
+	{
+		/* strip comments and whitespace */
+		if ((s = strstr(line, "//")) || (s = strchr(line, '#')))
+		{
+			*s = 0;
+		}
+
+		for (s = line; *s && isspace((unsigned char)*s); s++)
+		{
+		}
+
+		for (e = s + strlen(s); (e > s) && isspace((unsigned char)e[-1]); e--)
+		{
+		}
+
+		*e = 0;
+
+		if (!*s)
+		{
+			continue;
+		}
+
+		if (!Q_strncasecmp(s, "set filterban ", 14))
+		{
+			gi.cvar_set("filterban", s + 14);
+			continue;
+		}
+
+		if (!Q_strncasecmp(s, "sv ", 3))
+		{
+			s += 3;
+		}
+
+		if (!Q_strncasecmp(s, "addip ", 6))
+		{
+			s += 6;
+		}
+
+		if (!StringToFilter(s, &filter))
+		{
+			bad++;
+			continue;
+		}
+
+		added += IPTrieAdd(&ipfilters, &filter);
+	}
+
+	fclose(f);
+
+	gi.cprintf(NULL, PRINT_HIGH, "Loaded %i filters from %s, %i bad.\n",
+			added, name, bad);
+}
+
+/*
+ * Times the filter against a plain list
+ * scan, with random IPv4 and IPv6 ranges.
+ */
+void
+SVCmd_IPBench_f(void)
+{
+	iptrie_t trie;
+	ipfilter_t f;
+	byte (*addrs)[16];
+	int count, lookups, i, j, k;
+	int trie_hits, scan_hits;
+	qboolean hit;
+	clock_t start;
+	double build, triet, scant;
+
+	count = (gi.argc() > 2) ? atoi(gi.argv(2)) : 0;
+
+	if (count <= 0)
+	{
+		count = 100000;
+	}
+
+	lookups = 10000;
+
+	memset(&trie, 0, sizeof(trie));
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		memset(&f, 0, sizeof(f));
+
+		if (i & 1)
+		{
+			memcpy(f.addr, ipv4_mapped, sizeof(ipv4_mapped));
+			f.bits = 96 + 8 + randk_s(RANDK_TEST) % 25;
+
+			for (j = 12; j < 16; j++)
+			{
+				f.addr[j] = randk_s(RANDK_TEST);
+			}
+		}
+		else
+		{
+			f.bits = 16 + randk_s(RANDK_TEST) % 113;
+			f.addr[0] = 0x20;
+			f.addr[1] = 0x01;
+
+			for (j = 2; j < 16; j++)
+			{
+				f.addr[j] = randk_s(RANDK_TEST);
+			}
+		}
+
+		for (j = f.bits; j < 128; j++)
+		{
+			f.addr[j >> 3] &= ~(0x80 >> (j & 7));
+		}
+
+		IPTrieAdd(&trie, &f);
+	}
+
+	build = (double)(clock() - start);
+
+	/* half of the lookups hit a filter */
+	addrs = IPRealloc(NULL, lookups * sizeof(*addrs));
+
+	for (i = 0; i < lookups; i++)
+	{
+		if (i & 1)
+		{
+			memcpy(addrs[i], trie.filters[randk_s(RANDK_TEST) % trie.numfilters].addr, 16);
+		}
+		else
+		{
+			for (j = 0; j < 16; j++)
+			{
+				addrs[i][j] = randk_s(RANDK_TEST);
+			}
+
+			if (i & 2)
+			{
+				memcpy(addrs[i], ipv4_mapped, sizeof(ipv4_mapped));
+			}
+		}
+	}
+
+	start = clock();
+
+	for (i = 0, trie_hits = 0; i < lookups; i++)
+	{
+		trie_hits += IPTrieMatch(&trie, addrs[i]);
+	}
+
+	triet = (double)(clock() - start);
+	start = clock();
+
+	for (i = 0, scan_hits = 0; i < lookups; i++)
+	{
+		for (j = 0, hit = false; j < trie.numfilters && !hit; j++)
+		{
+			for (k = 0; k < trie.filters[j].bits; k++)
+			{
+				if (IPBit(addrs[i], k) != IPBit(trie.filters[j].addr, k))
+				{
+					break;
+				}
+			}
+
+			hit = (k == trie.filters[j].bits);
+		}
+
+		scan_hits += hit;
+	}
+
+	scant = (double)(clock() - start);
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i filters, %i nodes (%i KB), built in %.1f ms\n",
+			trie.numfilters, trie.numnodes,
+			(int)(trie.numnodes * sizeof(ipnode_t) / 1024),
+			build * 1000.0 / CLOCKS_PER_SEC);
+	gi.cprintf(NULL, PRINT_HIGH, "%i lookups: trie %.2f ms, list %.1f ms (%s)\n",
+			lookups, triet * 1000.0 / CLOCKS_PER_SEC, scant * 1000.0 / CLOCKS_PER_SEC,
+			(trie_hits == scan_hits) ? "same" : "DIFFERENT");
+
+	free(addrs);
+	IPTrieFree(&trie);
+}
+
+/*
+ * Prints the client command counters
+ * of the rate limit, see ClientCommand().
+ */
+void
+SVCmd_CmdStats_f(void)
+{
+	gclient_t *cl;
+	int i, count, dropped;
+
+	gi.cprintf(NULL, PRINT_HIGH, "num name             commands dropped tokens\n");
+	gi.cprintf(NULL, PRINT_HIGH, "--- ---------------- -------- ------- ------\n");
+
+	count = 0;
+	dropped = 0;
+
+	for (i = 0; i < game.maxclients; i++)
+	{
+		if (!g_edicts[i + 1].inuse)
+		{
+			continue;
+		}
+
+		cl = &game.clients[i];
+
+		gi.cprintf(NULL, PRINT_HIGH, "%3i %-16s %8i %7i %6.1f\n", i,
+				cl->pers.netname, cl->resp.cmd_count, cl->resp.cmd_dropped,
+				cl->resp.cmd_tokens);
+
+		count += cl->resp.cmd_count;
+		dropped += cl->resp.cmd_dropped;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "total %i commands, %i dropped\n",
+			count, dropped);
+}
+
+/*
+ * Benchmarks the PRNG and runs some
+ * sanity checks on its output. Uses
+ * its own stream, so the game isn't
+ * affected.
+ */
+void
+SVCmd_RandTest_f(void)
+{
+	int buckets[64];
+	int bits[31];
+	int count, i, b, r;
+	int bitsmin, bitsmax;
+	double sum, chi, expected, mean, sigma;
+	clock_t start, end;
+
+	count = (gi.argc() > 2) ? atoi(gi.argv(2)) : 0;
+
+	if (count <= 0)
+	{
+		count = 1 << 22;
+	}
+
+	/* throughput */
+	r = 0;
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		r ^= randk_s(RANDK_TEST);
+	}
+
+	end = clock();
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i numbers in %.1f ms (%x)\n", count,
+			(end - start) * 1000.0 / CLOCKS_PER_SEC, r & 0xf);
+
+	/* distribution */
+	memset(buckets, 0, sizeof(buckets));
+	memset(bits, 0, sizeof(bits));
+	sum = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		r = randk_s(RANDK_TEST);
+
+		/* frandk() and friends use the low 15 bits */
+		buckets[(r & 0x7fff) >> 9]++;
+		sum += (r & 0x7fff) / 32767.0;
+
+		for (b = 0; b < 31; b++)
+		{
+			bits[b] += (r >> b) & 1;
+		}
+	}
+
+	/* mean of the floats, should be 0.5 */
+	mean = sum / count;
+	sigma = 0.2887 / sqrt(count);
+
+	/* chi-square with 63 degrees of
+	   freedom, mean 63 and sigma 11.2 */
+	expected = count / 64.0;
+	chi = 0;
+
+	for (i = 0; i < 64; i++)
+	{
+		chi += (buckets[i] - expected) * (buckets[i] - expected) / expected;
+	}
+
+	bitsmin = bitsmax = bits[0];
+
+	for (b = 1; b < 31; b++)
+	{
+		bitsmin = (bits[b] < bitsmin) ? bits[b] : bitsmin;
+		bitsmax = (bits[b] > bitsmax) ? bits[b] : bitsmax;
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "mean %.5f (%s)\n", mean,
+			(fabs(mean - 0.5) < 5 * sigma) ? "ok" : "BAD");
+	gi.cprintf(NULL, PRINT_HIGH, "chi-square %.1f (%s)\n", chi,
+			(chi < 63 + 5 * 11.2) ? "ok" : "BAD");
+	gi.cprintf(NULL, PRINT_HIGH, "bits set %.4f - %.4f (%s)\n",
+			(double)bitsmin / count, (double)bitsmax / count,
+			((fabs(bitsmin - count / 2.0) < 5 * 0.5 * sqrt(count)) &&
+			 (fabs(bitsmax - count / 2.0) < 5 * 0.5 * sqrt(count))) ? "ok" : "BAD");
+}
+
+/*
+ * Times the batch vector functions against
+ * loops of the single ones and checks that
+ * both give the same bits.
+ */
+void
+SVCmd_MathBench_f(void)
+{
+	vec3_t *in, *a, *b, *f1, *f2;
+	vec_t *out1, *out2;
+	clock_t start;
+	double single, batch;
+	int count, i, j;
+	qboolean same;
+
+	count = (gi.argc() > 2) ? atoi(gi.argv(2)) : 0;
+
+	if (count <= 0)
+	{
+		count = 1 << 18;
+	}
+
+	in = gi.TagMalloc(count * sizeof(vec3_t), TAG_GAME);
+	a = gi.TagMalloc(count * sizeof(vec3_t), TAG_GAME);
+	b = gi.TagMalloc(count * sizeof(vec3_t), TAG_GAME);
+	f1 = gi.TagMalloc(count * sizeof(vec3_t), TAG_GAME);
+	f2 = gi.TagMalloc(count * sizeof(vec3_t), TAG_GAME);
+	out1 = gi.TagMalloc(count * sizeof(vec_t), TAG_GAME);
+	out2 = gi.TagMalloc(count * sizeof(vec_t), TAG_GAME);
+
+	for (i = 0; i < count; i++)
+	{
+		for (j = 0; j < 3; j++)
+		{
+			in[i][j] = crandk_s(RANDK_TEST) * 4096;
+		}
+	}
+
+	/* every 16th vector is zero, VectorNormalize() skips those */
+	for (i = 0; i < count; i += 16)
+	{
+		VectorClear(in[i]);
+	}
+
+	/* VectorLength */
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		out1[i] = VectorLength(in[i]);
+	}
+
+	single = (double)(clock() - start);
+	start = clock();
+	VectorLengthN(in, out2, count);
+	batch = (double)(clock() - start);
+	same = !memcmp(out1, out2, count * sizeof(vec_t));
+
+	gi.cprintf(NULL, PRINT_HIGH, "VectorLength    %7.2f ms, batch %7.2f ms (%s)\n",
+			single * 1000.0 / CLOCKS_PER_SEC, batch * 1000.0 / CLOCKS_PER_SEC,
+			same ? "same" : "DIFFERENT");
+
+	/* VectorNormalize */
+	memcpy(a, in, count * sizeof(vec3_t));
+	memcpy(b, in, count * sizeof(vec3_t));
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		out1[i] = VectorNormalize(a[i]);
+	}
+
+	single = (double)(clock() - start);
+	start = clock();
+	VectorNormalizeN(b, out2, count);
+	batch = (double)(clock() - start);
+	same = !memcmp(out1, out2, count * sizeof(vec_t)) &&
+		   !memcmp(a, b, count * sizeof(vec3_t));
+
+	gi.cprintf(NULL, PRINT_HIGH, "VectorNormalize %7.2f ms, batch %7.2f ms (%s)\n",
+			single * 1000.0 / CLOCKS_PER_SEC, batch * 1000.0 / CLOCKS_PER_SEC,
+			same ? "same" : "DIFFERENT");
+
+	/* DotProduct, of the input and its normal */
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		out1[i] = DotProduct(in[i], a[i]);
+	}
+
+	single = (double)(clock() - start);
+	start = clock();
+	DotProductN(in, a, out2, count);
+	batch = (double)(clock() - start);
+	same = !memcmp(out1, out2, count * sizeof(vec_t));
+
+	gi.cprintf(NULL, PRINT_HIGH, "DotProduct      %7.2f ms, batch %7.2f ms (%s)\n",
+			single * 1000.0 / CLOCKS_PER_SEC, batch * 1000.0 / CLOCKS_PER_SEC,
+			same ? "same" : "DIFFERENT");
+
+	/* AngleVectors, the input taken as angles */
+	start = clock();
+
+	for (i = 0; i < count; i++)
+	{
+		AngleVectors(in[i], f1[i], NULL, NULL);
+	}
+
+	single = (double)(clock() - start);
+	start = clock();
+	AngleVectorsN(in, f2, NULL, NULL, count);
+	batch = (double)(clock() - start);
+	same = !memcmp(f1, f2, count * sizeof(vec3_t));
+
+	gi.cprintf(NULL, PRINT_HIGH, "AngleVectors    %7.2f ms, batch %7.2f ms (%s)\n",
+			single * 1000.0 / CLOCKS_PER_SEC, batch * 1000.0 / CLOCKS_PER_SEC,
+			same ? "same" : "DIFFERENT");
+
+	gi.TagFree(out2);
+	gi.TagFree(out1);
+	gi.TagFree(f2);
+	gi.TagFree(f1);
+	gi.TagFree(b);
+	gi.TagFree(a);
+	gi.TagFree(in);
+}
+
+/*
+ * ServerCommand will be called when an "sv" command is issued.
+ * The game can issue gi.argc() / gi.argv() commands to get the rest
+ * of the parameters
+ */
+void
+ServerCommand(void)
+{
+	char *cmd;
+
+	cmd = gi.argv(1);
+	G_NetStatsSource(NULL);
+
+	if (Q_stricmp(cmd, "test") == 0)
+	{
+		Svcmd_Test_f();
+	}
+	else if (Q_stricmp(cmd, "addip") == 0)
+	{
+		SVCmd_AddIP_f();
+	}
+	else if (Q_stricmp(cmd, "removeip") == 0)
+	{
 		SVCmd_RemoveIP_f();
 	}
 	else if (Q_stricmp(cmd, "listip") == 0)
@@ -344,6 +1293,50 @@ ServerCommand(void)
 	{
 		SVCmd_WriteIP_f();
 	}
+	else if (Q_stricmp(cmd, "targetstats") == 0)
+	{
+		G_TargetGraphStats();
+	}
+	else if (Q_stricmp(cmd, "entstats") == 0)
+	{
+		G_InfoPoolStats();
+	}
+	else if (Q_stricmp(cmd, "cmdstats") == 0)
+	{
+		SVCmd_CmdStats_f();
+	}
+	else if (Q_stricmp(cmd, "netstats") == 0)
+	{
+		SVCmd_NetStats_f();
+	}
+	else if (Q_stricmp(cmd, "loadip") == 0)
+	{
+		SVCmd_LoadIP_f();
+	}
+	else if (Q_stricmp(cmd, "ipbench") == 0)
+	{
+		SVCmd_IPBench_f();
+	}
+	else if (Q_stricmp(cmd, "hudstats") == 0)
+	{
+		G_PrintStatsCounters();
+	}
+	else if (Q_stricmp(cmd, "weaponsreload") == 0)
+	{
+		koiWeaponLoad();
+	}
+	else if (Q_stricmp(cmd, "weaponswrite") == 0)
+	{
+		koiWeaponWrite();
+	}
+	else if (Q_stricmp(cmd, "randtest") == 0)
+	{
+		SVCmd_RandTest_f();
+	}
+	else if (Q_stricmp(cmd, "mathbench") == 0)
+	{
+		SVCmd_MathBench_f();
+	}
 	else
 	{
 		gi.cprintf(NULL, PRINT_HIGH, "Unknown server command \"%s\"\n", cmd);
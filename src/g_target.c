@@ -756,13 +756,14 @@ SP_target_crosslevel_target(edict_t *self)
 void
 target_laser_think(edict_t *self)
 {
-	edict_t *ignore;
+	piercehit_t hits[MAX_PIERCE_HITS];
 	vec3_t start;
 	vec3_t end;
 	trace_t tr;
 	vec3_t point;
 	vec3_t last_movedir;
-	int count;
+	edict_t *ignore;
+	int count, i, numhits, flags;
 
 	if (!self)
 	{
@@ -791,56 +792,66 @@ target_laser_think(edict_t *self)
 		}
 	}
 
-	ignore = self;
 	VectorCopy(self->s.origin, start);
 	VectorMA(start, 2048, self->movedir, end);
+	ignore = self;
+	flags = PIERCE_MONSTERS | PIERCE_CLIENTS | PIERCE_CACHE;
 
 	while (1)
 	{
-		tr = gi.trace(start, NULL, NULL, end, ignore,
-				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
+		numhits = G_PierceTrace(start, end, ignore,
+				CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER,
+				flags, hits, MAX_PIERCE_HITS, &tr);
 
-		if (!tr.ent)
+		for (i = 0; i < numhits; i++)
 		{
-			break;
-		}
-
-		/* hurt it if we can */
-		if ((tr.ent->takedamage) && !(tr.ent->flags & FL_IMMUNE_LASER))
-		{
-			T_Damage(tr.ent,
-					self,
-					self->activator,
-					self->movedir,
-					tr.endpos,
-					vec3_origin,
-					self->dmg,
-					1,
-					DAMAGE_ENERGY,
-					MOD_TARGET_LASER);
-		}
+			/* hurt it if we can */
+			if ((hits[i].ent->takedamage) &&
+				!(hits[i].ent->flags & FL_IMMUNE_LASER))
+			{
+				T_Damage(hits[i].ent,
+						self,
+						self->activator,
+						self->movedir,
+						hits[i].endpos,
+						vec3_origin,
+						self->dmg,
+						1,
+						DAMAGE_ENERGY,
+						MOD_TARGET_LASER);
+			}
 
-		/* if we hit something that's not a monster
-		   or player or is immune to lasers, we're done */
-		if (!(tr.ent->svflags & SVF_MONSTER) && (!tr.ent->client))
-		{
-			if (self->spawnflags & 0x80000000)
+			/* a gibbed monster stops the laser */
+			if ((hits[i].ent != tr.ent) &&
+				!(hits[i].ent->svflags & SVF_MONSTER) && (!hits[i].ent->client))
 			{
-				self->spawnflags &= ~0x80000000;
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(TE_LASER_SPARKS);
-				gi.WriteByte(count);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.WriteByte(self->s.skinnum);
-				gi.multicast(tr.endpos, MULTICAST_PVS);
+				G_PierceStopAt(&tr, &hits[i]);
+				break;
 			}
+		}
 
+		if ((i < numhits) || tr.ent)
+		{
 			break;
 		}
 
-		ignore = tr.ent;
+		/* out of hits, go on behind the last one */
+		ignore = hits[numhits - 1].ent;
 		VectorCopy(tr.endpos, start);
+		flags &= ~PIERCE_CACHE;
+	}
+
+	/* stopped by something that's not a monster or player */
+	if (tr.ent && (self->spawnflags & 0x80000000))
+	{
+		self->spawnflags &= ~0x80000000;
+		gi.WriteByte(svc_temp_entity);
+		gi.WriteByte(TE_LASER_SPARKS);
+		gi.WriteByte(count);
+		gi.WritePosition(tr.endpos);
+		gi.WriteDir(tr.plane.normal);
+		gi.WriteByte(self->s.skinnum);
+		gi.multicast(tr.endpos, MULTICAST_PVS);
 	}
 
 	VectorCopy(tr.endpos, self->s.old_origin);
@@ -1063,7 +1074,7 @@ target_lightramp_use(edict_t *self, edict_t *other /* unused */, edict_t *activa
 				break;
 			}
 
-			if (strcmp(e->classname, "light") != 0)
+			if (G_ClassAtom(e) != CN_light)
 			{
 				gi.dprintf("%s at %s ", self->classname, vtos(self->s.origin));
 				gi.dprintf("target %s (%s at %s) is not a light\n",
@@ -1159,17 +1170,9 @@ target_earthquake_think(edict_t *self)
 		self->last_move_time = level.time + 0.5;
 	}
 
-	for (i = 1, e = g_edicts + i; i < globals.num_edicts; i++, e++)
+	for (i = 0; i < g_numclients; i++)
 	{
-		if (!e->inuse)
-		{
-			continue;
-		}
-
-		if (!e->client)
-		{
-			continue;
-		}
+		e = g_clients[i];
 
 		if (!e->groundentity)
 		{
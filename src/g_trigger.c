@@ -469,6 +469,23 @@ SP_trigger_key(edict_t *self)
  * After the counter has been triggered "count" times (default 2),
  * it will fire all of it's targets and remove itself.
  */
+static void
+trigger_counter_message(edict_t *activator, const char *message)
+{
+	if (G_IsLogicEdict(activator))
+	{
+		/* trigger_always, func_timer and friends,
+		   the server doesn't know the entity */
+		gi.positioned_sound(activator->s.origin, g_edicts, CHAN_AUTO,
+				gi.soundindex("misc/talk1.wav"), 1, ATTN_NORM, 0);
+		return;
+	}
+
+	gi.centerprintf(activator, "%s", message);
+	gi.sound(activator, CHAN_AUTO, gi.soundindex(
+				"misc/talk1.wav"), 1, ATTN_NORM, 0);
+}
+
 void
 trigger_counter_use(edict_t *self, edict_t *other /* unused */,
 	   	edict_t *activator)
@@ -489,9 +506,8 @@ trigger_counter_use(edict_t *self, edict_t *other /* unused */,
 	{
 		if (!(self->spawnflags & 1))
 		{
-			gi.centerprintf(activator, "%i more to go...", self->count);
-			gi.sound(activator, CHAN_AUTO, gi.soundindex(
-						"misc/talk1.wav"), 1, ATTN_NORM, 0);
+			trigger_counter_message(activator,
+					va("%i more to go...", self->count));
 		}
 
 		return;
@@ -499,9 +515,7 @@ trigger_counter_use(edict_t *self, edict_t *other /* unused */,
 
 	if (!(self->spawnflags & 1))
 	{
-		gi.centerprintf(activator, "Sequence completed!");
-		gi.sound(activator, CHAN_AUTO, gi.soundindex(
-					"misc/talk1.wav"), 1, ATTN_NORM, 0);
+		trigger_counter_message(activator, "Sequence completed!");
 	}
 
 	self->activator = activator;
@@ -557,7 +571,7 @@ trigger_push_touch(edict_t *self, edict_t *other, cplane_t *plane /* unused */,
 		return;
 	}
 
-	if (strcmp(other->classname, "grenade") == 0)
+	if (G_ClassAtom(other) == CN_grenade)
 	{
 		VectorScale(self->movedir, self->speed * 10, other->velocity);
 	}
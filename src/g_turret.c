@@ -465,22 +465,22 @@ turret_driver_think(edict_t *self)
 			return;
 		}
 
-		self->monsterinfo.trail_time = level.time;
-		self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
+		self->monsterinfo->trail_time = level.time;
+		self->monsterinfo->aiflags &= ~AI_LOST_SIGHT;
 	}
 	else
 	{
 		if (visible(self, self->enemy))
 		{
-			if (self->monsterinfo.aiflags & AI_LOST_SIGHT)
+			if (self->monsterinfo->aiflags & AI_LOST_SIGHT)
 			{
-				self->monsterinfo.trail_time = level.time;
-				self->monsterinfo.aiflags &= ~AI_LOST_SIGHT;
+				self->monsterinfo->trail_time = level.time;
+				self->monsterinfo->aiflags &= ~AI_LOST_SIGHT;
 			}
 		}
 		else
 		{
-			self->monsterinfo.aiflags |= AI_LOST_SIGHT;
+			self->monsterinfo->aiflags |= AI_LOST_SIGHT;
 			return;
 		}
 	}
@@ -492,19 +492,19 @@ turret_driver_think(edict_t *self)
 	vectoangles(dir, self->target_ent->move_angles);
 
 	/* decide if we should shoot */
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 	{
 		return;
 	}
 
 	reaction_time = (3 - skill->value) * 1.0;
 
-	if ((level.time - self->monsterinfo.trail_time) < reaction_time)
+	if ((level.time - self->monsterinfo->trail_time) < reaction_time)
 	{
 		return;
 	}
 
-	self->monsterinfo.attack_finished = level.time + reaction_time + 1.0;
+	self->monsterinfo->attack_finished = level.time + reaction_time + 1.0;
 	self->target_ent->spawnflags |= 65536;
 }
 
@@ -565,6 +565,8 @@ SP_turret_driver(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	self->movetype = MOVETYPE_PUSH;
 	self->solid = SOLID_BBOX;
 	self->s.modelindex = gi.modelindex("models/monsters/infantry/tris.md2");
@@ -577,7 +579,7 @@ SP_turret_driver(edict_t *self)
 	self->viewheight = 24;
 
 	self->die = turret_driver_die;
-	self->monsterinfo.stand = infantry_stand;
+	self->monsterinfo->stand = infantry_stand;
 
 	self->flags |= FL_NO_KNOCKBACK;
 
@@ -589,7 +591,7 @@ SP_turret_driver(edict_t *self)
 	self->use = monster_use;
 	self->clipmask = MASK_MONSTERSOLID;
 	VectorCopy(self->s.origin, self->s.old_origin);
-	self->monsterinfo.aiflags |= AI_STAND_GROUND | AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_STAND_GROUND | AI_DUCKED;
 
 	if (st.item)
 	{
@@ -38,6 +38,310 @@ G_ProjectSource(vec3_t point, vec3_t distance, vec3_t forward,
 				distance[2];
 }
 
+/*
+ * Target graph. Maps each targetname to the
+ * edicts holding it, in the order G_Find()
+ * walks them, so firing order doesn't change.
+ * Built once the level is spawned or loaded.
+ * Lists are checked on use, so freed and
+ * renamed entities drop out by themselves.
+ * Code giving an entity a targetname must call
+ * G_TargetsChanged(), that list is rescanned
+ * when it's used next.
+ */
+typedef struct
+{
+	const char *name; /* NULL for an empty slot */
+	int *ents; /* edict numbers, ascending */
+	int num;
+	int max;
+	qboolean dirty; /* rescan on next use */
+} targetlist_t;
+
+static struct
+{
+	targetlist_t *lists; /* open addressing, TAG_LEVEL */
+	int size; /* power of two */
+	int num;
+	qboolean ready;
+
+	int lookups;
+	int rescans;
+} targets;
+
+static void
+TargetListAdd(targetlist_t *l, int n)
+{
+	int *ents;
+
+	if (l->num == l->max)
+	{
+		l->max = l->max ? l->max * 2 : 4;
+		ents = gi.TagMalloc(l->max * sizeof(int), TAG_LEVEL);
+
+		if (l->ents)
+		{
+			memcpy(ents, l->ents, l->num * sizeof(int));
+			gi.TagFree(l->ents);
+		}
+
+		l->ents = ents;
+	}
+
+	l->ents[l->num++] = n;
+}
+
+static targetlist_t *
+TargetList(const char *name, qboolean create)
+{
+	targetlist_t *old;
+	unsigned int slot;
+	int i, oldsize;
+
+	slot = Q_strhash(name) & (targets.size - 1);
+
+	while (targets.lists[slot].name)
+	{
+		if (!Q_stricmp(targets.lists[slot].name, name))
+		{
+			return &targets.lists[slot];
+		}
+
+		slot = (slot + 1) & (targets.size - 1);
+	}
+
+	if (!create)
+	{
+		return NULL;
+	}
+
+	/* keep it at most half full */
+	if ((targets.num + 1) * 2 > targets.size)
+	{
+		old = targets.lists;
+		oldsize = targets.size;
+
+		targets.size *= 2;
+		targets.lists = gi.TagMalloc(targets.size * sizeof(targetlist_t), TAG_LEVEL);
+		memset(targets.lists, 0, targets.size * sizeof(targetlist_t));
+
+		for (i = 0; i < oldsize; i++)
+		{
+			if (!old[i].name)
+			{
+				continue;
+			}
+
+			slot = Q_strhash(old[i].name) & (targets.size - 1);
+
+			while (targets.lists[slot].name)
+			{
+				slot = (slot + 1) & (targets.size - 1);
+			}
+
+			targets.lists[slot] = old[i];
+		}
+
+		gi.TagFree(old);
+
+		return TargetList(name, true);
+	}
+
+	targets.lists[slot].name = name;
+	targets.lists[slot].dirty = true;
+	targets.num++;
+
+	return &targets.lists[slot];
+}
+
+static void
+TargetListScan(targetlist_t *l)
+{
+	edict_t *e;
+
+	l->num = 0;
+	l->dirty = false;
+	targets.rescans++;
+
+	for (e = G_NextEdict(NULL); e; e = G_NextEdict(e))
+	{
+		if (e->inuse && e->targetname && !Q_stricmp(e->targetname, l->name))
+		{
+			TargetListAdd(l, G_NumForEdict(e));
+		}
+	}
+}
+
+/*
+ * Called whenever TAG_LEVEL is freed.
+ */
+void
+G_ClearTargetGraph(void)
+{
+	memset(&targets, 0, sizeof(targets));
+}
+
+void
+G_BuildTargetGraph(void)
+{
+	targetlist_t *l;
+	edict_t *e;
+	int count;
+
+	G_ClearTargetGraph();
+
+	for (count = 0, e = G_NextEdict(NULL); e; e = G_NextEdict(e))
+	{
+		if (e->inuse && e->targetname)
+		{
+			count++;
+		}
+	}
+
+	for (targets.size = 64; targets.size < count * 2; targets.size *= 2)
+	{
+	}
+
+	targets.lists = gi.TagMalloc(targets.size * sizeof(targetlist_t), TAG_LEVEL);
+	memset(targets.lists, 0, targets.size * sizeof(targetlist_t));
+
+	for (e = G_NextEdict(NULL); e; e = G_NextEdict(e))
+	{
+		if (e->inuse && e->targetname)
+		{
+			l = TargetList(e->targetname, true);
+			l->dirty = false;
+			TargetListAdd(l, G_NumForEdict(e));
+		}
+	}
+
+	targets.ready = true;
+}
+
+void
+G_TargetsChanged(const char *targetname)
+{
+	targetlist_t *l;
+
+	if (!targets.ready || !targetname)
+	{
+		return;
+	}
+
+	if ((l = TargetList(targetname, false)))
+	{
+		l->dirty = true;
+	}
+}
+
+/*
+ * G_Find() on targetname, through the graph.
+ */
+static edict_t *
+G_FindTarget(edict_t *from, char *match)
+{
+	targetlist_t *l;
+	edict_t *e;
+	int start, lo, hi, mid;
+
+	targets.lookups++;
+
+	l = TargetList(match, true);
+
+	if (l->dirty)
+	{
+		TargetListScan(l);
+	}
+
+	/* first entry at or after start */
+	start = from ? G_NumForEdict(from) + 1 : 0;
+	lo = 0;
+	hi = l->num;
+
+	while (lo < hi)
+	{
+		mid = (lo + hi) / 2;
+
+		if (l->ents[mid] < start)
+		{
+			lo = mid + 1;
+		}
+		else
+		{
+			hi = mid;
+		}
+	}
+
+	for ( ; lo < l->num; lo++)
+	{
+		e = G_EdictNum(l->ents[lo]);
+
+		if (e->inuse && e->targetname && !Q_stricmp(e->targetname, match))
+		{
+			return e;
+		}
+	}
+
+	return NULL;
+}
+
+void
+G_TargetGraphStats(void)
+{
+	targetlist_t *l, *largest;
+	edict_t *e;
+	int i, j, links, stale;
+
+	if (!targets.ready)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "No target graph, no level loaded.\n");
+		return;
+	}
+
+	links = 0;
+	stale = 0;
+	largest = NULL;
+
+	for (i = 0; i < targets.size; i++)
+	{
+		l = &targets.lists[i];
+
+		if (!l->name)
+		{
+			continue;
+		}
+
+		links += l->num;
+
+		for (j = 0; j < l->num; j++)
+		{
+			e = G_EdictNum(l->ents[j]);
+
+			if (!e->inuse || !e->targetname || Q_stricmp(e->targetname, l->name))
+			{
+				stale++;
+			}
+		}
+
+		if (!largest || (l->num > largest->num))
+		{
+			largest = l;
+		}
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i targetnames in %i slots, %i entities, %i stale\n",
+			targets.num, targets.size, links, stale);
+
+	if (largest)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "largest: \"%s\" with %i entities\n",
+				largest->name, largest->num);
+	}
+
+	gi.cprintf(NULL, PRINT_HIGH, "%i lookups, %i rescans\n",
+			targets.lookups, targets.rescans);
+}
+
 /*
  * Searches all active entities for the next
  * one that holds the matching string at fieldofs
@@ -52,13 +356,9 @@ G_Find(edict_t *from, int fieldofs, char *match)
 {
 	char *s;
 
-	if (!from)
-	{
-		from = g_edicts;
-	}
-	else
+	if (match && (fieldofs == FOFS(targetname)) && targets.ready)
 	{
-		from++;
+		return G_FindTarget(from, match);
 	}
 
 	if (!match)
@@ -66,7 +366,8 @@ G_Find(edict_t *from, int fieldofs, char *match)
 		return NULL;
 	}
 
-	for ( ; from < &g_edicts[globals.num_edicts]; from++)
+	/* g_edicts, then the logic entities */
+	for (from = G_NextEdict(from); from; from = G_NextEdict(from))
 	{
 		if (!from->inuse)
 		{
@@ -186,6 +487,10 @@ G_PickTarget(char *targetname)
 	return choice[randk() % num_choices];
 }
 
+/*
+ * Fires DelayedUse entities from savegames
+ * made before the delayed use queue.
+ */
 void
 Think_Delay(edict_t *ent)
 {
@@ -199,109 +504,346 @@ Think_Delay(edict_t *ent)
 }
 
 /*
- * The global "activator" should be set to
- * the entity that initiated the firing.
- *
- * If self.delay is set, a DelayedUse entity
- * will be created that will actually do the
- * SUB_UseTargets after that many seconds have passed.
- *
- * Centerprints any self.message to the activator.
- *
- * Search for (string)targetname in all entities that
- * match (string)self.target and call their .use function
+ * Delayed uses. G_UseTargets() with a delay
+ * queues the use here, ordered by time, and
+ * G_RunFrame() fires it in the same frame a
+ * DelayedUse entity would have thought. The
+ * use functions want an edict as "other", so
+ * all of them share one DelayedUse proxy per
+ * level instead of spawning one each.
+ */
+typedef struct
+{
+	float time;
+	edict_t *activator;
+	char *message;
+	char *target;
+	char *killtarget;
+} delayeduse_t;
+
+static struct
+{
+	delayeduse_t *uses; /* ascending time, TAG_LEVEL */
+	int num;
+	int max;
+	edict_t *proxy;
+} delayed;
+
+/*
+ * Called whenever TAG_LEVEL is freed.
  */
 void
-G_UseTargets(edict_t *ent, edict_t *activator)
+G_ClearDelayedUses(void)
 {
-	edict_t *t;
+	memset(&delayed, 0, sizeof(delayed));
+}
 
-	if (!ent)
-	{
-		return;
-	}
+static void
+DelayedUseAdd(const delayeduse_t *use)
+{
+	delayeduse_t *uses;
+	int i;
 
-	/* check for a delay */
-	if (ent->delay)
+	if (delayed.num == delayed.max)
 	{
-		/* create a temp object to fire at a later time */
-		t = G_Spawn();
-		t->classname = "DelayedUse";
-		t->nextthink = level.time + ent->delay;
-		t->think = Think_Delay;
-		t->activator = activator;
+		delayed.max = delayed.max ? delayed.max * 2 : 16;
+		uses = gi.TagMalloc(delayed.max * sizeof(delayeduse_t), TAG_LEVEL);
 
-		if (!activator)
+		if (delayed.uses)
 		{
-			gi.dprintf("Think_Delay with no activator\n");
+			memcpy(uses, delayed.uses, delayed.num * sizeof(delayeduse_t));
+			gi.TagFree(delayed.uses);
 		}
 
-		t->message = ent->message;
-		t->target = ent->target;
-		t->killtarget = ent->killtarget;
-		return;
+		delayed.uses = uses;
 	}
 
-	/* print the message */
-	if (activator && (ent->message) && !(activator->svflags & SVF_MONSTER))
+	/* after all uses with the same time */
+	for (i = delayed.num; i > 0 && (delayed.uses[i - 1].time > use->time); i--)
 	{
-		gi.centerprintf(activator, "%s", ent->message);
-
-		if (ent->noise_index)
-		{
-			gi.sound(activator, CHAN_AUTO, ent->noise_index, 1, ATTN_NORM, 0);
-		}
-		else
-		{
-			gi.sound(activator, CHAN_AUTO, gi.soundindex(
-							"misc/talk1.wav"), 1, ATTN_NORM, 0);
-		}
 	}
 
-	/* kill killtargets */
-	if (ent->killtarget)
+	memmove(&delayed.uses[i + 1], &delayed.uses[i],
+			(delayed.num - i) * sizeof(delayeduse_t));
+	delayed.uses[i] = *use;
+	delayed.num++;
+}
+
+static edict_t *
+DelayedUseProxy(void)
+{
+	if (!delayed.proxy || !delayed.proxy->inuse ||
+		(delayed.proxy->think != NULL) ||
+		Q_stricmp(delayed.proxy->classname, "DelayedUse"))
 	{
-		t = NULL;
+		delayed.proxy = G_SpawnLogic();
+		delayed.proxy->classname = "DelayedUse";
+		delayed.proxy->svflags |= SVF_NOCLIENT;
+	}
 
-		while ((t = G_Find(t, FOFS(targetname), ent->killtarget)))
+	return delayed.proxy;
+}
+
+/*
+ * Called by G_RunFrame() before the
+ * entities run, fires all due uses.
+ */
+void
+G_RunDelayedUses(void)
+{
+	delayeduse_t use;
+	edict_t *proxy;
+
+	while (delayed.num && (delayed.uses[0].time <= level.time + 0.001))
+	{
+		use = delayed.uses[0];
+		delayed.num--;
+		memmove(&delayed.uses[0], &delayed.uses[1],
+				delayed.num * sizeof(delayeduse_t));
+
+		proxy = DelayedUseProxy();
+		proxy->activator = use.activator;
+		proxy->message = use.message;
+		proxy->target = use.target;
+		proxy->killtarget = use.killtarget;
+
+		G_UseTargets(proxy, use.activator);
+
+		/* don't leave a phantom targeting
+		   them for G_Find() and listentities */
+		if (proxy->inuse && !Q_stricmp(proxy->classname, "DelayedUse"))
 		{
-			/* decrement secret count if target_secret is removed */
-			if (!Q_stricmp(t->classname,"target_secret"))
-			{
-				level.total_secrets--;
-			}
-			/* same deal with target_goal, but also turn off CD music if applicable */
-			else if (!Q_stricmp(t->classname,"target_goal"))
-			{
-				level.total_goals--;
+			proxy->activator = NULL;
+			proxy->message = NULL;
+			proxy->target = NULL;
+			proxy->killtarget = NULL;
+		}
+	}
+}
 
-				if (level.found_goals >= level.total_goals)
-				{
-					gi.configstring (CS_CDTRACK, "0");
-				}
-			}
+static void
+WriteDelayedString(FILE *f, const char *s)
+{
+	int len;
 
-			G_FreeEdict(t);
+	len = s ? (int)strlen(s) + 1 : 0;
+	fwrite(&len, sizeof(len), 1, f);
 
-			if (!ent->inuse)
-			{
-				gi.dprintf("entity was removed while using killtargets\n");
-				return;
-			}
-		}
+	if (len)
+	{
+		fwrite(s, len, 1, f);
 	}
+}
 
-	/* fire targets */
-	if (ent->target)
+static char *
+ReadDelayedString(FILE *f)
+{
+	char *s;
+	int len;
+
+	if ((fread(&len, sizeof(len), 1, f) != 1) || (len <= 0))
 	{
-		t = NULL;
+		return NULL;
+	}
 
-		while ((t = G_Find(t, FOFS(targetname), ent->target)))
+	s = gi.TagMalloc(len, TAG_LEVEL);
+
+	if (fread(s, len, 1, f) != 1)
+	{
+		s[0] = '\0';
+	}
+
+	s[len - 1] = '\0';
+
+	return s;
+}
+
+/*
+ * Written by WriteLevel() after the
+ * edicts, edicts are stored as numbers.
+ */
+void
+G_WriteDelayedUses(FILE *f)
+{
+	int i, n;
+
+	fwrite(&delayed.num, sizeof(delayed.num), 1, f);
+
+	n = delayed.proxy ? G_NumForEdict(delayed.proxy) : -1;
+	fwrite(&n, sizeof(n), 1, f);
+
+	for (i = 0; i < delayed.num; i++)
+	{
+		fwrite(&delayed.uses[i].time, sizeof(float), 1, f);
+
+		n = delayed.uses[i].activator ?
+			G_NumForEdict(delayed.uses[i].activator) : -1;
+		fwrite(&n, sizeof(n), 1, f);
+
+		WriteDelayedString(f, delayed.uses[i].message);
+		WriteDelayedString(f, delayed.uses[i].target);
+		WriteDelayedString(f, delayed.uses[i].killtarget);
+	}
+}
+
+/*
+ * Older savegames end before the queue
+ * and still hold DelayedUse entities.
+ */
+void
+G_ReadDelayedUses(FILE *f)
+{
+	delayeduse_t use;
+	int i, num, n;
+
+	G_ClearDelayedUses();
+
+	if (fread(&num, sizeof(num), 1, f) != 1)
+	{
+		return;
+	}
+
+	if ((fread(&n, sizeof(n), 1, f) == 1) && (n >= 0))
+	{
+		delayed.proxy = G_EdictNum(n);
+	}
+
+	for (i = 0; i < num; i++)
+	{
+		memset(&use, 0, sizeof(use));
+
+		if ((fread(&use.time, sizeof(float), 1, f) != 1) ||
+			(fread(&n, sizeof(n), 1, f) != 1))
+		{
+			gi.dprintf("G_ReadDelayedUses: truncated savegame\n");
+			return;
+		}
+
+		use.activator = (n >= 0) ? G_EdictNum(n) : NULL;
+		use.message = ReadDelayedString(f);
+		use.target = ReadDelayedString(f);
+		use.killtarget = ReadDelayedString(f);
+
+		DelayedUseAdd(&use);
+	}
+}
+
+/*
+ * The global "activator" should be set to
+ * the entity that initiated the firing.
+ *
+ * If self.delay is set, the use is queued and
+ * G_RunDelayedUses() will actually do the
+ * SUB_UseTargets after that many seconds have passed.
+ *
+ * Centerprints any self.message to the activator.
+ *
+ * Search for (string)targetname in all entities that
+ * match (string)self.target and call their .use function
+ */
+void
+G_UseTargets(edict_t *ent, edict_t *activator)
+{
+	edict_t *t;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	/* check for a delay */
+	if (ent->delay)
+	{
+		delayeduse_t use;
+
+		/* queue it to fire at a later time */
+		use.time = level.time + ent->delay;
+		use.activator = activator;
+
+		if (!activator)
+		{
+			gi.dprintf("Think_Delay with no activator\n");
+		}
+
+		use.message = ent->message;
+		use.target = ent->target;
+		use.killtarget = ent->killtarget;
+
+		DelayedUseAdd(&use);
+		return;
+	}
+
+	/* print the message */
+	if (activator && (ent->message) && !(activator->svflags & SVF_MONSTER))
+	{
+		if (G_IsLogicEdict(activator))
+		{
+			/* not a client, nobody to print to and
+			   the server doesn't know the entity */
+			gi.positioned_sound(activator->s.origin, g_edicts, CHAN_AUTO,
+					ent->noise_index ? ent->noise_index :
+					gi.soundindex("misc/talk1.wav"), 1, ATTN_NORM, 0);
+		}
+		else
+		{
+			gi.centerprintf(activator, "%s", ent->message);
+
+			if (ent->noise_index)
+			{
+				gi.sound(activator, CHAN_AUTO, ent->noise_index, 1, ATTN_NORM, 0);
+			}
+			else
+			{
+				gi.sound(activator, CHAN_AUTO, gi.soundindex(
+								"misc/talk1.wav"), 1, ATTN_NORM, 0);
+			}
+		}
+	}
+
+	/* kill killtargets */
+	if (ent->killtarget)
+	{
+		t = NULL;
+
+		while ((t = G_Find(t, FOFS(targetname), ent->killtarget)))
+		{
+			/* decrement secret count if target_secret is removed */
+			if (G_ClassAtom(t) == CN_target_secret)
+			{
+				level.total_secrets--;
+			}
+			/* same deal with target_goal, but also turn off CD music if applicable */
+			else if (G_ClassAtom(t) == CN_target_goal)
+			{
+				level.total_goals--;
+
+				if (level.found_goals >= level.total_goals)
+				{
+					gi.configstring (CS_CDTRACK, "0");
+				}
+			}
+
+			G_FreeEdict(t);
+
+			if (!ent->inuse)
+			{
+				gi.dprintf("entity was removed while using killtargets\n");
+				return;
+			}
+		}
+	}
+
+	/* fire targets */
+	if (ent->target)
+	{
+		t = NULL;
+
+		while ((t = G_Find(t, FOFS(targetname), ent->target)))
 		{
 			/* doors fire area portals in a specific way */
-			if (!Q_stricmp(t->classname, "func_areaportal") &&
-				(!Q_stricmp(ent->classname, "func_door") ||
-				 !Q_stricmp(ent->classname, "func_door_rotating")))
+			if ((G_ClassAtom(t) == CN_func_areaportal) &&
+				((G_ClassAtom(ent) == CN_func_door) ||
+				 (G_ClassAtom(ent) == CN_func_door_rotating)))
 			{
 				continue;
 			}
@@ -314,7 +856,9 @@ G_UseTargets(edict_t *ent, edict_t *activator)
 			{
 				if (t->use)
 				{
+					G_NetStatsPush(t, t->use);
 					t->use(t, ent, activator);
+					G_NetStatsPop();
 				}
 			}
 
@@ -489,6 +1033,117 @@ G_CopyString(char *in)
 	return out;
 }
 
+/*
+ * Classname atoms. Every classname is interned
+ * into a small number, so hot code can compare
+ * numbers instead of strings. The names from
+ * header/classnames.h have fixed CN_ numbers,
+ * any other name is numbered when first seen.
+ * Open addressing, slots hold the atom (0 is
+ * empty). Rebuilt by InitGame().
+ */
+#define MAX_CLASSATOMS 1024
+#define CLASSATOM_HASH_SIZE (MAX_CLASSATOMS * 2) /* power of two */
+
+static const char *known_classnames[CN_NUMKNOWN] = {
+	NULL,
+#define CLASSNAME(name) #name,
+#include "header/classnames.h"
+#undef CLASSNAME
+};
+
+static char *classatom_names[MAX_CLASSATOMS];
+static short classatom_hash[CLASSATOM_HASH_SIZE];
+static int num_classatoms;
+
+static int
+ClassAtomIntern(const char *name, qboolean known)
+{
+	unsigned int slot;
+	char *copy;
+
+	if (!name)
+	{
+		return CN_NONE;
+	}
+
+	slot = Q_strhash(name) & (CLASSATOM_HASH_SIZE - 1);
+
+	while (classatom_hash[slot])
+	{
+		if (!Q_stricmp(classatom_names[classatom_hash[slot]], name))
+		{
+			return classatom_hash[slot];
+		}
+
+		slot = (slot + 1) & (CLASSATOM_HASH_SIZE - 1);
+	}
+
+	if (num_classatoms == MAX_CLASSATOMS)
+	{
+		gi.error("ClassAtomIntern: more than %i classnames", MAX_CLASSATOMS);
+	}
+
+	/* map strings go away with the level */
+	if (known)
+	{
+		copy = (char *)name;
+	}
+	else
+	{
+		copy = gi.TagMalloc(strlen(name) + 1, TAG_GAME);
+		strcpy(copy, name);
+	}
+
+	classatom_names[num_classatoms] = copy;
+	classatom_hash[slot] = num_classatoms;
+
+	return num_classatoms++;
+}
+
+void
+G_InitClassAtoms(void)
+{
+	int i;
+
+	memset(classatom_names, 0, sizeof(classatom_names));
+	memset(classatom_hash, 0, sizeof(classatom_hash));
+	num_classatoms = 1;
+
+	for (i = 1; i < CN_NUMKNOWN; i++)
+	{
+		ClassAtomIntern(known_classnames[i], true);
+	}
+}
+
+const char *
+G_ClassAtomName(int atom)
+{
+	if ((atom <= CN_NONE) || (atom >= num_classatoms))
+	{
+		return "";
+	}
+
+	return classatom_names[atom];
+}
+
+/*
+ * Returns the atom of the entities classname.
+ * classname is assigned all over the code,
+ * so the atom is cached until it changes.
+ */
+int
+G_ClassAtom(edict_t *ent)
+{
+	if (ent->classname != ent->classatom_of)
+	{
+		ent->classatom = ClassAtomIntern(ent->classname, false);
+		ent->classatom_of = ent->classname;
+	}
+
+	return ent->classatom;
+}
+
 void
 G_InitEdict(edict_t *e)
 {
@@ -496,6 +1151,10 @@ G_InitEdict(edict_t *e)
 	e->classname = "noclass";
 	e->gravity = 1.0;
 	e->s.number = e - g_edicts;
+
+	/* still queued by G_FreeEdict() */
+	e->monsterinfo = NULL;
+	e->moveinfo = NULL;
 }
 
 /*
@@ -563,82 +1222,818 @@ G_Spawn(void)
 }
 
 /*
- * Marks the edict as free
+ * Server-only logic entities. Relays, timers,
+ * spawn points, switchable lights and the like
+ * are never sent to clients. They only think,
+ * get used and are found by target lookups, so
+ * they live in growable TAG_LEVEL chunks outside
+ * g_edicts and leave the networked slots to the
+ * rest. Their numbers continue after the last
+ * slot of g_edicts and are kept in s.number.
+ * They must not be linked or handed to imports
+ * taking an edict, like gi.sound().
  */
-void
-G_FreeEdict(edict_t *ed)
+#define LOGIC_CHUNK 64
+
+static struct
+{
+	edict_t **chunks;
+	int numchunks;
+	int maxchunks;
+	int num; /* like globals.num_edicts */
+} logic;
+
+static edict_t *
+LogicEdict(int i)
 {
-	gi.unlinkentity(ed); /* unlink from world */
+	edict_t **chunks;
+	edict_t *chunk;
+	int j;
 
-	if (deathmatch->value || coop->value)
+	while (i >= logic.numchunks * LOGIC_CHUNK)
 	{
-		if ((ed - g_edicts) <= (maxclients->value + BODY_QUEUE_SIZE))
+		if (logic.numchunks == logic.maxchunks)
 		{
-			return;
+			logic.maxchunks = logic.maxchunks ? logic.maxchunks * 2 : 8;
+			chunks = gi.TagMalloc(logic.maxchunks * sizeof(edict_t *), TAG_LEVEL);
+
+			if (logic.chunks)
+			{
+				memcpy(chunks, logic.chunks, logic.numchunks * sizeof(edict_t *));
+				gi.TagFree(logic.chunks);
+			}
+
+			logic.chunks = chunks;
 		}
-	}
-	else
-	{
-		if ((ed - g_edicts) <= maxclients->value)
+
+		chunk = gi.TagMalloc(LOGIC_CHUNK * sizeof(edict_t), TAG_LEVEL);
+		memset(chunk, 0, LOGIC_CHUNK * sizeof(edict_t));
+
+		/* even unused slots know their number */
+		for (j = 0; j < LOGIC_CHUNK; j++)
 		{
-			return;
+			chunk[j].s.number = game.maxentities +
+				logic.numchunks * LOGIC_CHUNK + j;
 		}
+
+		logic.chunks[logic.numchunks++] = chunk;
 	}
 
-	memset(ed, 0, sizeof(*ed));
-	ed->classname = "freed";
-	ed->freetime = level.time;
-	ed->inuse = false;
+	if (i >= logic.num)
+	{
+		logic.num = i + 1;
+	}
+
+	return &logic.chunks[i / LOGIC_CHUNK][i % LOGIC_CHUNK];
 }
 
+/*
+ * Must be called whenever TAG_LEVEL is freed.
+ */
 void
-G_TouchTriggers(edict_t *ent)
+G_ClearLogicEdicts(void)
 {
-	int i, num;
-	edict_t *touch[MAX_EDICTS], *hit;
+	memset(&logic, 0, sizeof(logic));
+}
 
-	if (!ent)
-	{
-		return;
-	}
+qboolean
+G_IsLogicEdict(const edict_t *e)
+{
+	return (e < g_edicts) || (e >= g_edicts + game.maxentities);
+}
 
-	/* dead things don't activate triggers! */
-	if ((ent->client || (ent->svflags & SVF_MONSTER)) && (ent->health <= 0))
+int
+G_NumForEdict(const edict_t *e)
+{
+	if (G_IsLogicEdict(e))
 	{
-		return;
+		return e->s.number;
 	}
 
-	num = gi.BoxEdicts(ent->absmin, ent->absmax, touch,
-			MAX_EDICTS, AREA_TRIGGERS);
+	return e - g_edicts;
+}
 
-	/* be careful, it is possible to have an entity in this
-	   list removed before we get to it (killtriggered) */
-	for (i = 0; i < num; i++)
+/*
+ * Logic slots are created on demand,
+ * ReadLevel() fills them in any order.
+ */
+edict_t *
+G_EdictNum(int n)
+{
+	if (n < game.maxentities)
 	{
-		hit = touch[i];
-
-		if (!hit->inuse)
-		{
-			continue;
-		}
-
-		if (!hit->touch)
-		{
-			continue;
-		}
-
-		hit->touch(hit, ent, NULL, NULL);
+		return &g_edicts[n];
 	}
+
+	return LogicEdict(n - game.maxentities);
 }
 
 /*
- * Call after linking a new trigger
- * in during gameplay to force all
- * entities it covers to immediately
- * touch it
+ * First edict numbered n or higher, walking
+ * g_edicts and then the logic entities.
  */
-void
-G_TouchSolids(edict_t *ent)
+edict_t *
+G_EdictFrom(int n)
+{
+	if (n < globals.num_edicts)
+	{
+		return &g_edicts[(n > 0) ? n : 0];
+	}
+
+	if (n < game.maxentities)
+	{
+		n = game.maxentities;
+	}
+
+	if (n - game.maxentities < logic.num)
+	{
+		return LogicEdict(n - game.maxentities);
+	}
+
+	return NULL;
+}
+
+edict_t *
+G_NextEdict(edict_t *from)
+{
+	return G_EdictFrom(from ? G_NumForEdict(from) + 1 : 0);
+}
+
+edict_t *
+G_SpawnLogic(void)
+{
+	edict_t *e;
+	int i;
+
+	/* same reuse policy as G_FindFreeEdict() */
+	for (i = 0; i < logic.num; i++)
+	{
+		e = LogicEdict(i);
+
+		if (!e->inuse && ((e->freetime < 2.0f) || ((level.time - e->freetime) > 0.5f)))
+		{
+			break;
+		}
+	}
+
+	e = LogicEdict(i);
+	e->inuse = true;
+	e->classname = "noclass";
+	e->gravity = 1.0;
+	e->s.number = game.maxentities + i;
+	e->monsterinfo = NULL;
+	e->moveinfo = NULL;
+
+	return e;
+}
+
+/*
+ * Moves a parsed but not yet spawned
+ * entity from g_edicts into the logic
+ * pool, the slot is free again.
+ */
+edict_t *
+G_MoveToLogic(edict_t *ent)
+{
+	edict_t *e;
+	int number;
+
+	e = G_SpawnLogic();
+	number = e->s.number;
+	*e = *ent;
+	e->s.number = number;
+
+	memset(ent, 0, sizeof(*ent));
+	ent->classname = "freed";
+	ent->freetime = level.time;
+	ent->inuse = false;
+
+	return e;
+}
+
+static int
+G_LogicEdictsUsed(void)
+{
+	int i, used;
+
+	for (i = 0, used = 0; i < logic.num; i++)
+	{
+		if (LogicEdict(i)->inuse)
+		{
+			used++;
+		}
+	}
+
+	return used;
+}
+
+/*
+ * Monster and mover state lives outside of
+ * the edict, most entities need neither and
+ * the edict array stays small. The blocks are
+ * carved from TAG_LEVEL chunks and handed back
+ * to the pool by G_FreeEdict(). Released blocks
+ * are chained through their first bytes.
+ *
+ * Monsters and movers often free themselves deep
+ * down in their think, and the callers up the
+ * stack still read the state afterwards. So a
+ * freed edict keeps its blocks, cleared like the
+ * old embedded structs were, and they go back to
+ * the pools at the end of the frame.
+ */
+#define INFO_POOL_CHUNK 64
+
+typedef struct
+{
+	const char *name;
+	size_t size;
+	void *free;
+	byte *chunk;
+	int left; /* unused blocks in chunk */
+	int used;
+	int allocated;
+} infopool_t;
+
+static infopool_t monsterinfo_pool = {"monsterinfo", sizeof(monsterinfo_t)};
+static infopool_t moveinfo_pool = {"moveinfo", sizeof(moveinfo_t)};
+
+typedef struct
+{
+	edict_t *ent;
+	monsterinfo_t *monsterinfo;
+	moveinfo_t *moveinfo;
+} inforelease_t;
+
+static struct
+{
+	inforelease_t *list;
+	int num;
+	int max;
+} inforelease;
+
+static void *
+G_PoolAlloc(infopool_t *pool)
+{
+	void *p;
+
+	if (pool->free)
+	{
+		p = pool->free;
+		pool->free = *(void **)p;
+	}
+	else
+	{
+		if (!pool->left)
+		{
+			pool->chunk = gi.TagMalloc(INFO_POOL_CHUNK * pool->size, TAG_LEVEL);
+			pool->left = INFO_POOL_CHUNK;
+			pool->allocated += INFO_POOL_CHUNK;
+		}
+
+		p = pool->chunk;
+		pool->chunk += pool->size;
+		pool->left--;
+	}
+
+	memset(p, 0, pool->size);
+	pool->used++;
+
+	return p;
+}
+
+static void
+G_PoolFree(infopool_t *pool, void *p)
+{
+	*(void **)p = pool->free;
+	pool->free = p;
+	pool->used--;
+}
+
+static void
+G_PoolClear(infopool_t *pool)
+{
+	pool->free = NULL;
+	pool->chunk = NULL;
+	pool->left = 0;
+	pool->used = 0;
+	pool->allocated = 0;
+}
+
+void
+G_AllocMonsterInfo(edict_t *ent)
+{
+	if (!ent->monsterinfo)
+	{
+		ent->monsterinfo = G_PoolAlloc(&monsterinfo_pool);
+	}
+}
+
+void
+G_AllocMoveInfo(edict_t *ent)
+{
+	if (!ent->moveinfo)
+	{
+		ent->moveinfo = G_PoolAlloc(&moveinfo_pool);
+	}
+}
+
+/*
+ * Must be called whenever TAG_LEVEL is freed.
+ */
+void
+G_ClearInfoPools(void)
+{
+	G_PoolClear(&monsterinfo_pool);
+	G_PoolClear(&moveinfo_pool);
+	memset(&inforelease, 0, sizeof(inforelease));
+}
+
+/*
+ * Called by G_FreeEdict(), the blocks
+ * stay with the edict until the end
+ * of the frame.
+ */
+static void
+G_QueueInfoRelease(edict_t *ent)
+{
+	inforelease_t *list;
+
+	if (inforelease.num == inforelease.max)
+	{
+		inforelease.max = inforelease.max ? inforelease.max * 2 : 64;
+		list = gi.TagMalloc(inforelease.max * sizeof(*list), TAG_LEVEL);
+
+		if (inforelease.list)
+		{
+			memcpy(list, inforelease.list, inforelease.num * sizeof(*list));
+			gi.TagFree(inforelease.list);
+		}
+
+		inforelease.list = list;
+	}
+
+	list = &inforelease.list[inforelease.num++];
+	list->ent = ent;
+	list->monsterinfo = ent->monsterinfo;
+	list->moveinfo = ent->moveinfo;
+
+	if (ent->monsterinfo)
+	{
+		memset(ent->monsterinfo, 0, sizeof(monsterinfo_t));
+	}
+
+	if (ent->moveinfo)
+	{
+		memset(ent->moveinfo, 0, sizeof(moveinfo_t));
+	}
+}
+
+/*
+ * Called by G_RunFrame() after all entities
+ * ran, hands the blocks of the edicts freed
+ * since the last call back to their pools.
+ * An edict that was reused in the meantime
+ * already got new blocks or none at all.
+ */
+void
+G_ReleaseInfoBlocks(void)
+{
+	inforelease_t *r;
+	int i;
+
+	for (i = 0; i < inforelease.num; i++)
+	{
+		r = &inforelease.list[i];
+
+		if (r->monsterinfo)
+		{
+			G_PoolFree(&monsterinfo_pool, r->monsterinfo);
+
+			if (r->ent->monsterinfo == r->monsterinfo)
+			{
+				r->ent->monsterinfo = NULL;
+			}
+		}
+
+		if (r->moveinfo)
+		{
+			G_PoolFree(&moveinfo_pool, r->moveinfo);
+
+			if (r->ent->moveinfo == r->moveinfo)
+			{
+				r->ent->moveinfo = NULL;
+			}
+		}
+	}
+
+	inforelease.num = 0;
+}
+
+static void
+G_PoolStats(infopool_t *pool)
+{
+	gi.cprintf(NULL, PRINT_HIGH, "%-12s %4i bytes, %5i used, %5i allocated, %8i bytes\n",
+			pool->name, (int)pool->size, pool->used, pool->allocated,
+			(int)(pool->allocated * pool->size));
+}
+
+void
+G_InfoPoolStats(void)
+{
+	gi.cprintf(NULL, PRINT_HIGH, "%-12s %4i bytes, %5i used, %5i slots,     %8i bytes\n",
+			"edict_t", (int)sizeof(edict_t), globals.num_edicts, game.maxentities,
+			(int)(game.maxentities * sizeof(edict_t)));
+	gi.cprintf(NULL, PRINT_HIGH, "%-12s %4i bytes, %5i used, %5i allocated, %8i bytes\n",
+			"logic", (int)sizeof(edict_t), G_LogicEdictsUsed(),
+			logic.numchunks * LOGIC_CHUNK,
+			(int)(logic.numchunks * LOGIC_CHUNK * sizeof(edict_t)));
+	G_PoolStats(&monsterinfo_pool);
+	G_PoolStats(&moveinfo_pool);
+}
+
+/*
+ * Marks the edict as free
+ */
+void
+G_FreeEdict(edict_t *ed)
+{
+	monsterinfo_t *monsterinfo;
+	moveinfo_t *moveinfo;
+	qboolean islogic;
+	int number;
+
+	islogic = G_IsLogicEdict(ed);
+	number = ed->s.number;
+
+	if (!islogic)
+	{
+		gi.unlinkentity(ed); /* unlink from world */
+
+		if (ed->solid == SOLID_TRIGGER)
+		{
+			G_ForgetTrigger(ed);
+		}
+
+		if (deathmatch->value || coop->value)
+		{
+			if ((ed - g_edicts) <= (maxclients->value + BODY_QUEUE_SIZE))
+			{
+				return;
+			}
+		}
+		else
+		{
+			if ((ed - g_edicts) <= maxclients->value)
+			{
+				return;
+			}
+		}
+	}
+
+	monsterinfo = ed->monsterinfo;
+	moveinfo = ed->moveinfo;
+
+	/* freed twice, the blocks are queued already */
+	if (ed->inuse && (monsterinfo || moveinfo))
+	{
+		G_QueueInfoRelease(ed);
+	}
+
+	memset(ed, 0, sizeof(*ed));
+	ed->classname = "freed";
+	ed->freetime = level.time;
+	ed->inuse = false;
+	ed->monsterinfo = monsterinfo;
+	ed->moveinfo = moveinfo;
+
+	if (islogic)
+	{
+		ed->s.number = number;
+	}
+}
+
+/*
+ * Trigger contact cache. G_TouchTriggers() asks the
+ * server for the triggers in a box a bit larger than
+ * the entity and remembers them. As long as the entity
+ * stays inside that box and no trigger was linked into
+ * it, the exact contacts are found by checking the
+ * remembered triggers only. The touch functions are
+ * still called every time, exactly as before.
+ */
+#define TRIGGER_CACHE_SIZE 8
+#define TRIGGER_CACHE_PAD 32
+
+typedef struct
+{
+	int num; /* -1 if not filled */
+	qboolean listed; /* in trigger_filled */
+	vec3_t mins, maxs; /* padded box */
+	edict_t *hits[TRIGGER_CACHE_SIZE];
+	int linkcounts[TRIGGER_CACHE_SIZE];
+} trigger_cache_t;
+
+static trigger_cache_t *trigger_cache;
+static int *trigger_filled; /* edict numbers of filled caches */
+static int num_trigger_filled;
+static void (*real_linkentity)(edict_t *ent);
+
+/*
+ * Replaces gi.linkentity(). A trigger linked
+ * into the box of a cache isn't in it yet,
+ * that cache is dropped. Triggers already in
+ * a cache are checked by their linkcount, so
+ * moving items only hit caches they reach.
+ */
+static void
+G_LinkEntity(edict_t *ent)
+{
+	trigger_cache_t *cache;
+	int i, j;
+
+	real_linkentity(ent);
+
+	/* may have changed cluster or area */
+	if (ent && ent->client)
+	{
+		G_EffectClientsMoved();
+	}
+
+	if (!ent || (ent->solid != SOLID_TRIGGER))
+	{
+		return;
+	}
+
+	for (i = 0; i < num_trigger_filled; )
+	{
+		cache = &trigger_cache[trigger_filled[i]];
+
+		if (cache->num >= 0)
+		{
+			for (j = 0; j < 3; j++)
+			{
+				if ((ent->absmin[j] > cache->maxs[j]) ||
+					(ent->absmax[j] < cache->mins[j]))
+				{
+					break;
+				}
+			}
+
+			if (j < 3)
+			{
+				i++;
+				continue;
+			}
+
+			cache->num = -1;
+		}
+
+		cache->listed = false;
+		trigger_filled[i] = trigger_filled[--num_trigger_filled];
+	}
+}
+
+void
+G_InitTriggerCache(void)
+{
+	int i;
+
+	if (!real_linkentity)
+	{
+		real_linkentity = gi.linkentity;
+		gi.linkentity = G_LinkEntity;
+	}
+
+	trigger_cache = gi.TagMalloc(game.maxentities * sizeof(*trigger_cache),
+			TAG_GAME);
+	trigger_filled = gi.TagMalloc(game.maxentities * sizeof(*trigger_filled),
+			TAG_GAME);
+	num_trigger_filled = 0;
+
+	for (i = 0; i < game.maxentities; i++)
+	{
+		trigger_cache[i].num = -1;
+		trigger_cache[i].listed = false;
+	}
+}
+
+/*
+ * Drops all caches, called when a level
+ * starts. The slots hold new entities
+ * and the linkcounts start over.
+ */
+void
+G_ClearTriggerCache(void)
+{
+	int i;
+
+	for (i = 0; i < num_trigger_filled; i++)
+	{
+		trigger_cache[trigger_filled[i]].num = -1;
+		trigger_cache[trigger_filled[i]].listed = false;
+	}
+
+	num_trigger_filled = 0;
+}
+
+/*
+ * Called by G_FreeEdict(), drops the caches
+ * holding the trigger. The next entity in
+ * its slot may reach the same linkcount.
+ */
+void
+G_ForgetTrigger(edict_t *ent)
+{
+	trigger_cache_t *cache;
+	int i, j;
+
+	for (i = 0; i < num_trigger_filled; )
+	{
+		cache = &trigger_cache[trigger_filled[i]];
+
+		for (j = 0; j < cache->num; j++)
+		{
+			if (cache->hits[j] == ent)
+			{
+				break;
+			}
+		}
+
+		if ((cache->num >= 0) && (j == cache->num))
+		{
+			i++;
+			continue;
+		}
+
+		cache->num = -1;
+		cache->listed = false;
+		trigger_filled[i] = trigger_filled[--num_trigger_filled];
+	}
+}
+
+static qboolean
+TriggerCacheValid(edict_t *ent, trigger_cache_t *cache)
+{
+	edict_t *hit;
+	int i;
+
+	if (cache->num < 0)
+	{
+		return false;
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		if ((ent->absmin[i] < cache->mins[i]) ||
+			(ent->absmax[i] > cache->maxs[i]))
+		{
+			return false;
+		}
+	}
+
+	/* unlinked, moved, removed or no trigger anymore */
+	for (i = 0; i < cache->num; i++)
+	{
+		hit = cache->hits[i];
+
+		if (!hit->inuse || (hit->solid != SOLID_TRIGGER) ||
+			!hit->area.prev || (hit->linkcount != cache->linkcounts[i]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static int
+TriggerCacheFill(edict_t *ent, trigger_cache_t *cache, edict_t **touch)
+{
+	int i, num;
+
+	for (i = 0; i < 3; i++)
+	{
+		cache->mins[i] = ent->absmin[i] - TRIGGER_CACHE_PAD;
+		cache->maxs[i] = ent->absmax[i] + TRIGGER_CACHE_PAD;
+	}
+
+	num = gi.BoxEdicts(cache->mins, cache->maxs, touch,
+			MAX_EDICTS, AREA_TRIGGERS);
+
+	/* too crowded, ask again next time */
+	if (num > TRIGGER_CACHE_SIZE)
+	{
+		cache->num = -1;
+		return num;
+	}
+
+	cache->num = num;
+
+	if (!cache->listed)
+	{
+		cache->listed = true;
+		trigger_filled[num_trigger_filled++] = ent - g_edicts;
+	}
+
+	for (i = 0; i < num; i++)
+	{
+		cache->hits[i] = touch[i];
+		cache->linkcounts[i] = touch[i]->linkcount;
+	}
+
+	return num;
+}
+
+void
+G_TouchTriggers(edict_t *ent)
+{
+	int i, j, num, count;
+	edict_t *touch[MAX_EDICTS], *hit;
+	trigger_cache_t *cache;
+
+	if (!ent)
+	{
+		return;
+	}
+
+	/* dead things don't activate triggers! */
+	if ((ent->client || (ent->svflags & SVF_MONSTER)) && (ent->health <= 0))
+	{
+		return;
+	}
+
+	cache = &trigger_cache[ent - g_edicts];
+
+	if (TriggerCacheValid(ent, cache))
+	{
+		num = cache->num;
+		memcpy(touch, cache->hits, num * sizeof(touch[0]));
+	}
+	else
+	{
+		num = TriggerCacheFill(ent, cache, touch);
+	}
+
+	/* keep what the exact box touches, in the
+	   order the server returned it. Same test
+	   as the servers SV_AreaEdicts() */
+	for (i = 0, count = 0; i < num; i++)
+	{
+		hit = touch[i];
+
+		if (hit->solid == SOLID_NOT)
+		{
+			continue;
+		}
+
+		for (j = 0; j < 3; j++)
+		{
+			if ((hit->absmin[j] > ent->absmax[j]) ||
+				(hit->absmax[j] < ent->absmin[j]))
+			{
+				break;
+			}
+		}
+
+		if (j == 3)
+		{
+			touch[count++] = hit;
+		}
+	}
+
+	num = count;
+
+	/* be careful, it is possible to have an entity in this
+	   list removed before we get to it (killtriggered) */
+	for (i = 0; i < num; i++)
+	{
+		hit = touch[i];
+
+		if (!hit->inuse)
+		{
+			continue;
+		}
+
+		if (!hit->touch)
+		{
+			continue;
+		}
+
+		G_NetStatsPush(hit, hit->touch);
+		hit->touch(hit, ent, NULL, NULL);
+		G_NetStatsPop();
+	}
+}
+
+/*
+ * Call after linking a new trigger
+ * in during gameplay to force all
+ * entities it covers to immediately
+ * touch it
+ */
+void
+G_TouchSolids(edict_t *ent)
 {
 	int i, num;
 	edict_t *touch[MAX_EDICTS], *hit;
@@ -712,3 +2107,360 @@ KillBox(edict_t *ent)
 
 	return true; /* all clear */
 }
+
+/*
+ * Piercing traces for lasers, the railgun
+ * and the BFG. Instead of restarting the
+ * trace behind every monster it passes,
+ * the solid geometry is traced once and
+ * the boxes along the segment are clipped
+ * here, nearest first.
+ */
+
+#define PIERCE_EPSILON 0.03125 /* the servers DIST_EPSILON */
+
+typedef struct
+{
+	qboolean valid;
+	vec3_t start;
+	vec3_t end;
+	int mask;
+	trace_t tr;
+} pierce_cache_t;
+
+typedef struct
+{
+	edict_t *ent;
+	float frac;
+	vec3_t normal;
+} pierce_box_t;
+
+static pierce_cache_t *pierce_cache;
+static csurface_t pierce_nullsurface;
+
+void
+G_InitPierceCache(void)
+{
+	pierce_cache = gi.TagMalloc(game.maxentities * sizeof(*pierce_cache),
+			TAG_GAME);
+}
+
+/*
+ * Cached traces only hold for the
+ * world they were made in.
+ */
+void
+G_ClearPierceCache(void)
+{
+	if (pierce_cache)
+	{
+		memset(pierce_cache, 0, game.maxentities * sizeof(*pierce_cache));
+	}
+}
+
+/*
+ * Clips the segment against the box of a
+ * SOLID_BBOX entity, like the server does
+ * for a point trace.
+ */
+static qboolean
+PierceClipBox(const vec3_t start, const vec3_t delta, edict_t *ent,
+		pierce_box_t *box)
+{
+	float enter, leave, t1, t2, t;
+	int i, axis;
+
+	enter = -1;
+	leave = 1;
+	axis = -1;
+
+	for (i = 0; i < 3; i++)
+	{
+		t1 = ent->s.origin[i] + ent->mins[i];
+		t2 = ent->s.origin[i] + ent->maxs[i];
+
+		if (delta[i] == 0)
+		{
+			if ((start[i] < t1) || (start[i] > t2))
+			{
+				return false;
+			}
+
+			continue;
+		}
+
+		t1 = (t1 - start[i]) / delta[i];
+		t2 = (t2 - start[i]) / delta[i];
+
+		if (t1 > t2)
+		{
+			t = t1;
+			t1 = t2;
+			t2 = t;
+		}
+
+		if (t1 > enter)
+		{
+			enter = t1;
+			axis = i;
+		}
+
+		if (t2 < leave)
+		{
+			leave = t2;
+		}
+
+		if ((enter > leave) || (leave < 0))
+		{
+			return false;
+		}
+	}
+
+	box->ent = ent;
+	box->frac = 0;
+	VectorClear(box->normal);
+
+	/* starting inside counts as a hit right away */
+	if ((axis >= 0) && (enter > 0))
+	{
+		box->normal[axis] = (delta[axis] > 0) ? -1 : 1;
+		box->frac = enter - PIERCE_EPSILON / fabs(delta[axis]);
+
+		if (box->frac < 0)
+		{
+			box->frac = 0;
+		}
+	}
+
+	return true;
+}
+
+static qboolean
+PierceThrough(edict_t *ent, int flags)
+{
+	if ((flags & PIERCE_DAMAGEABLE) && !ent->takedamage)
+	{
+		return false;
+	}
+
+	if (flags & PIERCE_BBOX)
+	{
+		return true;
+	}
+
+	if ((flags & PIERCE_MONSTERS) && (ent->svflags & SVF_MONSTER))
+	{
+		return true;
+	}
+
+	if ((flags & PIERCE_CLIENTS) && ent->client)
+	{
+		return true;
+	}
+
+	return false;
+}
+
+static void
+PierceAddHit(piercehit_t *hit, edict_t *ent, const vec3_t endpos,
+		const vec3_t normal)
+{
+	hit->ent = ent;
+	VectorCopy(endpos, hit->endpos);
+	VectorCopy(normal, hit->normal);
+}
+
+/*
+ * Ends a piercing trace early at one of its hits,
+ * for callers that find out only after damaging it
+ * that the hit can't be passed (gibbed monsters).
+ */
+void
+G_PierceStopAt(trace_t *stop, const piercehit_t *hit)
+{
+	VectorCopy(hit->endpos, stop->endpos);
+	VectorCopy(hit->normal, stop->plane.normal);
+	stop->plane.dist = DotProduct(hit->endpos, hit->normal);
+	stop->contents = CONTENTS_MONSTER;
+	stop->ent = hit->ent;
+}
+
+/*
+ * Traces a line from start to end and returns every
+ * entity it hits, nearest first. Entities selected by
+ * flags (PIERCE_*) are passed through, anything else
+ * stops the trace and is returned as the last hit and
+ * in stop. Like the old gi.trace() loops, the entity
+ * just passed is ignored together with its owner.
+ *
+ * If the hits fill up before the trace stops, stop->ent
+ * is NULL and stop ends at the last hit. Callers go on
+ * from there with that hit as ignore, until stop->ent
+ * is set, so any number of entities can be pierced.
+ *
+ * PIERCE_CACHE remembers the world part of the trace
+ * for the ignore entity, as long as start, end and
+ * mask don't change and no brush model gets in the way.
+ */
+int
+G_PierceTrace(vec3_t start, vec3_t end, edict_t *ignore, int mask,
+		int flags, piercehit_t *hits, int maxhits, trace_t *stop)
+{
+	static edict_t *touch[MAX_EDICTS];
+	static pierce_box_t boxes[MAX_EDICTS];
+	pierce_cache_t *cache;
+	pierce_box_t box;
+	vec3_t delta, mins, maxs, endpos;
+	int i, j, num, count, numhits;
+	edict_t *pass, *e;
+	float frac;
+	qboolean cached;
+	trace_t tr;
+
+	VectorSubtract(end, start, delta);
+
+	cache = NULL;
+	cached = false;
+
+	if ((flags & PIERCE_CACHE) && ignore && pierce_cache)
+	{
+		cache = &pierce_cache[ignore - g_edicts];
+
+		cached = cache->valid && (cache->mask == mask) &&
+				 VectorCompare(cache->start, start) &&
+				 VectorCompare(cache->end, end);
+	}
+
+	if (cached)
+	{
+		tr = cache->tr;
+	}
+	else
+	{
+		tr = gi.trace(start, NULL, NULL, end, ignore,
+				mask & ~(CONTENTS_MONSTER | CONTENTS_DEADMONSTER));
+	}
+
+	for (i = 0; i < 3; i++)
+	{
+		mins[i] = ((start[i] < tr.endpos[i]) ? start[i] : tr.endpos[i]) - 1;
+		maxs[i] = ((start[i] > tr.endpos[i]) ? start[i] : tr.endpos[i]) + 1;
+	}
+
+	num = gi.BoxEdicts(mins, maxs, touch, MAX_EDICTS, AREA_SOLID);
+
+	/* a door or platform may have moved in. The
+	   cached trace hit the world, so the real one
+	   can only be shorter and touch is still good */
+	if (cached)
+	{
+		for (i = 0; i < num; i++)
+		{
+			e = touch[i];
+
+			if ((e->solid == SOLID_BSP) && (e != ignore) &&
+				(e->owner != ignore) && (ignore->owner != e))
+			{
+				cached = false;
+				tr = gi.trace(start, NULL, NULL, end, ignore,
+						mask & ~(CONTENTS_MONSTER | CONTENTS_DEADMONSTER));
+				break;
+			}
+		}
+	}
+
+	if (cache && !cached)
+	{
+		cache->valid = (tr.ent == world);
+		cache->mask = mask;
+		VectorCopy(start, cache->start);
+		VectorCopy(end, cache->end);
+		cache->tr = tr;
+	}
+
+	/* boxes in front of the world, nearest first */
+	count = 0;
+
+	for (i = 0; (i < num) && (mask & CONTENTS_MONSTER); i++)
+	{
+		e = touch[i];
+
+		if (e->solid != SOLID_BBOX)
+		{
+			continue;
+		}
+
+		if ((e->svflags & SVF_DEADMONSTER) && !(mask & CONTENTS_DEADMONSTER))
+		{
+			continue;
+		}
+
+		if (!PierceClipBox(start, delta, e, &box) || (box.frac >= tr.fraction))
+		{
+			continue;
+		}
+
+		for (j = count; (j > 0) && (boxes[j - 1].frac > box.frac); j--)
+		{
+			boxes[j] = boxes[j - 1];
+		}
+
+		boxes[j] = box;
+		count++;
+	}
+
+	pass = ignore;
+	numhits = 0;
+	frac = 0;
+
+	for (i = 0; i < count; i++)
+	{
+		e = boxes[i].ent;
+
+		if ((e == pass) || (pass && ((e->owner == pass) || (pass->owner == e))))
+		{
+			continue;
+		}
+
+		if (numhits == maxhits)
+		{
+			break;
+		}
+
+		VectorMA(start, boxes[i].frac, delta, endpos);
+		PierceAddHit(&hits[numhits++], e, endpos, boxes[i].normal);
+
+		if (!PierceThrough(e, flags))
+		{
+			memset(stop, 0, sizeof(*stop));
+			stop->fraction = boxes[i].frac;
+			VectorCopy(endpos, stop->endpos);
+			VectorCopy(boxes[i].normal, stop->plane.normal);
+			stop->plane.dist = DotProduct(endpos, boxes[i].normal);
+			stop->surface = &pierce_nullsurface;
+			stop->contents = CONTENTS_MONSTER;
+			stop->ent = e;
+
+			return numhits;
+		}
+
+		pass = e;
+		frac = boxes[i].frac;
+	}
+
+	if (numhits < maxhits)
+	{
+		PierceAddHit(&hits[numhits++], tr.ent, tr.endpos, tr.plane.normal);
+		*stop = tr;
+
+		return numhits;
+	}
+
+	/* out of room, end at the last hit */
+	memset(stop, 0, sizeof(*stop));
+	stop->fraction = frac;
+	VectorMA(start, frac, delta, stop->endpos);
+	stop->surface = &pierce_nullsurface;
+
+	return numhits;
+}
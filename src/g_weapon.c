@@ -57,11 +57,11 @@ check_dodge(edict_t *self, vec3_t start, vec3_t dir, int speed)
 	tr = gi.trace(start, NULL, NULL, end, self, MASK_SHOT);
 
 	if ((tr.ent) && (tr.ent->svflags & SVF_MONSTER) && (tr.ent->health > 0) &&
-		(tr.ent->monsterinfo.dodge) && infront(tr.ent, self))
+		(tr.ent->monsterinfo->dodge) && infront(tr.ent, self))
 	{
 		VectorSubtract(tr.endpos, start, v);
 		eta = (VectorLength(v) - tr.ent->maxs[0]) / speed;
-		tr.ent->monsterinfo.dodge(tr.ent, self, eta);
+		tr.ent->monsterinfo->dodge(tr.ent, self, eta);
 	}
 }
 
@@ -196,8 +196,8 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 		vectoangles(aimdir, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * hspread;
-		u = crandom() * vspread;
+		r = crandom_s(RANDK_WEAPONS) * hspread;
+		u = crandom_s(RANDK_WEAPONS) * vspread;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
@@ -245,7 +245,8 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 					color = SPLASH_UNKNOWN;
 				}
 
-				if (color != SPLASH_UNKNOWN)
+				if ((color != SPLASH_UNKNOWN) &&
+					G_EffectVisible(tr.endpos, MULTICAST_PVS, EFFECT_SPLASH))
 				{
 					gi.WriteByte(svc_temp_entity);
 					gi.WriteByte(TE_SPLASH);
@@ -260,8 +261,8 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 				VectorSubtract(end, start, dir);
 				vectoangles(dir, dir);
 				AngleVectors(dir, forward, right, up);
-				r = crandom() * hspread * 2;
-				u = crandom() * vspread * 2;
+				r = crandom_s(RANDK_WEAPONS) * hspread * 2;
+				u = crandom_s(RANDK_WEAPONS) * vspread * 2;
 				VectorMA(water_start, 8192, forward, end);
 				VectorMA(end, r, right, end);
 				VectorMA(end, u, up, end);
@@ -286,11 +287,14 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 			{
 				if (strncmp(tr.surface->name, "sky", 3) != 0)
 				{
-					gi.WriteByte(svc_temp_entity);
-					gi.WriteByte(te_impact);
-					gi.WritePosition(tr.endpos);
-					gi.WriteDir(tr.plane.normal);
-					gi.multicast(tr.endpos, MULTICAST_PVS);
+					if (G_EffectVisible(tr.endpos, MULTICAST_PVS, EFFECT_POINTDIR))
+					{
+						gi.WriteByte(svc_temp_entity);
+						gi.WriteByte(te_impact);
+						gi.WritePosition(tr.endpos);
+						gi.WriteDir(tr.plane.normal);
+						gi.multicast(tr.endpos, MULTICAST_PVS);
+					}
 
 					if (self->client)
 					{
@@ -323,11 +327,14 @@ fire_lead(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick,
 		VectorAdd(water_start, tr.endpos, pos);
 		VectorScale(pos, 0.5, pos);
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BUBBLETRAIL);
-		gi.WritePosition(water_start);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(pos, MULTICAST_PVS);
+		if (G_EffectVisible(pos, MULTICAST_PVS, EFFECT_LINE))
+		{
+			gi.WriteByte(svc_temp_entity);
+			gi.WriteByte(TE_BUBBLETRAIL);
+			gi.WritePosition(water_start);
+			gi.WritePosition(tr.endpos);
+			gi.multicast(pos, MULTICAST_PVS);
+		}
 	}
 }
 
@@ -423,7 +430,7 @@ blaster_touch(edict_t *self, edict_t *other, cplane_t *plane, csurface_t *surf)
 					vec3_origin, self->dmg, 1, DAMAGE_ENERGY, mod);
 		}
 	}
-	else
+	else if (G_EffectVisible(self->s.origin, MULTICAST_PVS, EFFECT_POINTDIR))
 	{
 		gi.WriteByte(svc_temp_entity);
 		gi.WriteByte(TE_BLASTER);
@@ -564,33 +571,37 @@ Grenade_Explode(edict_t *ent)
 	T_RadiusDamage(ent, ent->owner, ent->dmg, ent->enemy, ent->dmg_radius, mod);
 
 	VectorMA(ent->s.origin, -0.02, ent->velocity, origin);
-	gi.WriteByte(svc_temp_entity);
 
-	if (ent->waterlevel)
+	if (G_EffectVisible(ent->s.origin, MULTICAST_PHS, EFFECT_POINT))
 	{
-		if (ent->groundentity)
-		{
-			gi.WriteByte(TE_GRENADE_EXPLOSION_WATER);
-		}
-		else
-		{
-			gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
-		}
-	}
-	else
-	{
-		if (ent->groundentity)
+		gi.WriteByte(svc_temp_entity);
+
+		if (ent->waterlevel)
 		{
-			gi.WriteByte(TE_GRENADE_EXPLOSION);
+			if (ent->groundentity)
+			{
+				gi.WriteByte(TE_GRENADE_EXPLOSION_WATER);
+			}
+			else
+			{
+				gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
+			}
 		}
 		else
 		{
-			gi.WriteByte(TE_ROCKET_EXPLOSION);
+			if (ent->groundentity)
+			{
+				gi.WriteByte(TE_GRENADE_EXPLOSION);
+			}
+			else
+			{
+				gi.WriteByte(TE_ROCKET_EXPLOSION);
+			}
 		}
-	}
 
-	gi.WritePosition(origin);
-	gi.multicast(ent->s.origin, MULTICAST_PHS);
+		gi.WritePosition(origin);
+		gi.multicast(ent->s.origin, MULTICAST_PHS);
+	}
 
 	G_FreeEdict(ent);
 }
@@ -662,8 +673,8 @@ fire_grenade(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int speed,
 	grenade = G_Spawn();
 	VectorCopy(start, grenade->s.origin);
 	VectorScale(aimdir, speed, grenade->velocity);
-	VectorMA(grenade->velocity, 200 + crandom() * 10.0, up, grenade->velocity);
-	VectorMA(grenade->velocity, crandom() * 10.0, right, grenade->velocity);
+	VectorMA(grenade->velocity, 200 + crandom_s(RANDK_WEAPONS) * 10.0, up, grenade->velocity);
+	VectorMA(grenade->velocity, crandom_s(RANDK_WEAPONS) * 10.0, right, grenade->velocity);
 	VectorSet(grenade->avelocity, 300, 300, 300);
 	grenade->movetype = MOVETYPE_BOUNCE;
 	grenade->clipmask = MASK_SHOT;
@@ -702,8 +713,8 @@ fire_grenade2(edict_t *self, vec3_t start, vec3_t aimdir, int damage,
 	grenade = G_Spawn();
 	VectorCopy(start, grenade->s.origin);
 	VectorScale(aimdir, speed, grenade->velocity);
-	VectorMA(grenade->velocity, 200 + crandom() * 10.0, up, grenade->velocity);
-	VectorMA(grenade->velocity, crandom() * 10.0, right, grenade->velocity);
+	VectorMA(grenade->velocity, 200 + crandom_s(RANDK_WEAPONS) * 10.0, up, grenade->velocity);
+	VectorMA(grenade->velocity, crandom_s(RANDK_WEAPONS) * 10.0, right, grenade->velocity);
 	VectorSet(grenade->avelocity, 300, 300, 300);
 	grenade->movetype = MOVETYPE_BOUNCE;
 	grenade->clipmask = MASK_SHOT;
@@ -809,19 +820,22 @@ rocket_touch(edict_t *ent, edict_t *other, cplane_t *plane, csurface_t *surf)
 	T_RadiusDamage(ent, ent->owner, ent->radius_dmg, other, ent->dmg_radius,
 			MOD_R_SPLASH);
 
-	gi.WriteByte(svc_temp_entity);
-
-	if (ent->waterlevel)
-	{
-		gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
-	}
-	else
+	if (G_EffectVisible(ent->s.origin, MULTICAST_PHS, EFFECT_POINT))
 	{
-		gi.WriteByte(TE_ROCKET_EXPLOSION);
-	}
+		gi.WriteByte(svc_temp_entity);
+
+		if (ent->waterlevel)
+		{
+			gi.WriteByte(TE_ROCKET_EXPLOSION_WATER);
+		}
+		else
+		{
+			gi.WriteByte(TE_ROCKET_EXPLOSION);
+		}
 
-	gi.WritePosition(origin);
-	gi.multicast(ent->s.origin, MULTICAST_PHS);
+		gi.WritePosition(origin);
+		gi.multicast(ent->s.origin, MULTICAST_PHS);
+	}
 
 	G_FreeEdict(ent);
 }
@@ -870,11 +884,12 @@ fire_rocket(edict_t *self, vec3_t start, vec3_t dir, int damage,
 void
 fire_rail(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick)
 {
+	piercehit_t hits[MAX_PIERCE_HITS];
 	vec3_t from;
 	vec3_t end;
 	trace_t tr;
 	edict_t *ignore;
-	int mask;
+	int mask, i, numhits;
 	qboolean water;
 
 	if (!self)
@@ -888,49 +903,57 @@ fire_rail(edict_t *self, vec3_t start, vec3_t aimdir, int damage, int kick)
 	water = false;
 	mask = MASK_SHOT | CONTENTS_SLIME | CONTENTS_LAVA;
 
-	while (ignore)
+	while (1)
 	{
-		tr = gi.trace(from, NULL, NULL, end, ignore, mask);
+		numhits = G_PierceTrace(from, end, ignore, mask,
+				PIERCE_BBOX | PIERCE_DAMAGEABLE, hits, MAX_PIERCE_HITS, &tr);
 
-		if (tr.contents & (CONTENTS_SLIME | CONTENTS_LAVA))
+		for (i = 0; i < numhits; i++)
 		{
-			mask &= ~(CONTENTS_SLIME | CONTENTS_LAVA);
-			water = true;
-		}
-		else
-		{
-			if ((tr.ent->svflags & SVF_MONSTER) || (tr.ent->client) ||
-				(tr.ent->solid == SOLID_BBOX))
+			if ((hits[i].ent != self) && (hits[i].ent->takedamage))
 			{
-				ignore = tr.ent;
-			}
-			else
-			{
-				ignore = NULL;
+				T_Damage(hits[i].ent, self, self, aimdir, hits[i].endpos,
+						hits[i].normal, damage, kick, 0, MOD_RAILGUN);
 			}
+		}
 
-			if ((tr.ent != self) && (tr.ent->takedamage))
-			{
-				T_Damage(tr.ent, self, self, aimdir, tr.endpos, tr.plane.normal,
-						damage, kick, 0, MOD_RAILGUN);
-			}
-			else
-			{
-				ignore = NULL;
-			}
+		/* out of hits, go on behind the last one */
+		if (!tr.ent)
+		{
+			ignore = hits[numhits - 1].ent;
+			VectorCopy(tr.endpos, from);
+			continue;
+		}
+
+		if (!(tr.contents & (CONTENTS_SLIME | CONTENTS_LAVA)))
+		{
+			break;
+		}
+
+		/* keep going below the surface, the
+		   last hit is the surface itself */
+		mask &= ~(CONTENTS_SLIME | CONTENTS_LAVA);
+		water = true;
+
+		if (numhits > 1)
+		{
+			ignore = hits[numhits - 2].ent;
 		}
 
 		VectorCopy(tr.endpos, from);
 	}
 
 	/* send gun puff / flash */
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_RAILTRAIL);
-	gi.WritePosition(start);
-	gi.WritePosition(tr.endpos);
-	gi.multicast(self->s.origin, MULTICAST_PHS);
+	if (G_EffectVisible(self->s.origin, MULTICAST_PHS, EFFECT_LINE))
+	{
+		gi.WriteByte(svc_temp_entity);
+		gi.WriteByte(TE_RAILTRAIL);
+		gi.WritePosition(start);
+		gi.WritePosition(tr.endpos);
+		gi.multicast(self->s.origin, MULTICAST_PHS);
+	}
 
-	if (water)
+	if (water && G_EffectVisible(tr.endpos, MULTICAST_PHS, EFFECT_LINE))
 	{
 		gi.WriteByte(svc_temp_entity);
 		gi.WriteByte(TE_RAILTRAIL);
@@ -996,10 +1019,13 @@ bfg_explode(edict_t *self)
 				points = points * 0.5;
 			}
 
-			gi.WriteByte(svc_temp_entity);
-			gi.WriteByte(TE_BFG_EXPLOSION);
-			gi.WritePosition(ent->s.origin);
-			gi.multicast(ent->s.origin, MULTICAST_PHS);
+			if (G_EffectVisible(ent->s.origin, MULTICAST_PHS, EFFECT_POINT))
+			{
+				gi.WriteByte(svc_temp_entity);
+				gi.WriteByte(TE_BFG_EXPLOSION);
+				gi.WritePosition(ent->s.origin);
+				gi.multicast(ent->s.origin, MULTICAST_PHS);
+			}
 			T_Damage(ent, self, self->owner, self->velocity, ent->s.origin, vec3_origin,
 					(int)points, 0, DAMAGE_ENERGY, MOD_BFG_EFFECT);
 		}
@@ -1074,22 +1100,25 @@ bfg_touch(edict_t *self, edict_t *other, cplane_t *plane, csurface_t *surf)
 
 	gi.linkentity(self);
 
-	gi.WriteByte(svc_temp_entity);
-	gi.WriteByte(TE_BFG_BIGEXPLOSION);
-	gi.WritePosition(self->s.origin);
-	gi.multicast(self->s.origin, MULTICAST_PVS);
+	if (G_EffectVisible(self->s.origin, MULTICAST_PVS, EFFECT_POINT))
+	{
+		gi.WriteByte(svc_temp_entity);
+		gi.WriteByte(TE_BFG_BIGEXPLOSION);
+		gi.WritePosition(self->s.origin);
+		gi.multicast(self->s.origin, MULTICAST_PVS);
+	}
 }
 
 void
 bfg_think(edict_t *self)
 {
-	edict_t *ent;
-	edict_t *ignore;
+	piercehit_t hits[MAX_PIERCE_HITS];
+	edict_t *ent, *ignore;
 	vec3_t point;
 	vec3_t dir;
-	vec3_t start;
+	vec3_t from;
 	vec3_t end;
-	int dmg;
+	int dmg, i, numhits;
 	trace_t tr;
 
 	if (!self)
@@ -1126,7 +1155,7 @@ bfg_think(edict_t *self)
 		}
 
 		if (!(ent->svflags & SVF_MONSTER) && (!ent->client) &&
-			(strcmp(ent->classname, "misc_explobox") != 0))
+			(G_ClassAtom(ent) != CN_misc_explobox))
 		{
 			continue;
 		}
@@ -1136,50 +1165,66 @@ bfg_think(edict_t *self)
 		VectorSubtract(point, self->s.origin, dir);
 		VectorNormalize(dir);
 
+		VectorMA(self->s.origin, 2048, dir, end);
+		VectorCopy(self->s.origin, from);
 		ignore = self;
-		VectorCopy(self->s.origin, start);
-		VectorMA(start, 2048, dir, end);
 
 		while (1)
 		{
-			tr = gi.trace(start, NULL, NULL, end, ignore,
-					CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER);
+			numhits = G_PierceTrace(from, end, ignore,
+					CONTENTS_SOLID | CONTENTS_MONSTER | CONTENTS_DEADMONSTER,
+					PIERCE_MONSTERS | PIERCE_CLIENTS, hits, MAX_PIERCE_HITS, &tr);
 
-			if (!tr.ent)
+			for (i = 0; i < numhits; i++)
 			{
-				break;
-			}
+				/* hurt it if we can */
+				if ((hits[i].ent->takedamage) &&
+					!(hits[i].ent->flags & FL_IMMUNE_LASER) &&
+					(hits[i].ent != self->owner))
+				{
+					T_Damage(hits[i].ent, self, self->owner, dir, hits[i].endpos,
+							vec3_origin, dmg, 1, DAMAGE_ENERGY, MOD_BFG_LASER);
+				}
 
-			/* hurt it if we can */
-			if ((tr.ent->takedamage) && !(tr.ent->flags & FL_IMMUNE_LASER) &&
-				(tr.ent != self->owner))
-			{
-				T_Damage(tr.ent, self, self->owner, dir, tr.endpos, vec3_origin,
-						dmg, 1, DAMAGE_ENERGY, MOD_BFG_LASER);
+				/* a gibbed monster stops the laser */
+				if ((hits[i].ent != tr.ent) &&
+					!(hits[i].ent->svflags & SVF_MONSTER) && (!hits[i].ent->client))
+				{
+					G_PierceStopAt(&tr, &hits[i]);
+					break;
+				}
 			}
 
-			/* if we hit something that's not a monster or player we're done */
-			if (!(tr.ent->svflags & SVF_MONSTER) && (!tr.ent->client))
+			if ((i < numhits) || tr.ent)
 			{
-				gi.WriteByte(svc_temp_entity);
-				gi.WriteByte(TE_LASER_SPARKS);
-				gi.WriteByte(4);
-				gi.WritePosition(tr.endpos);
-				gi.WriteDir(tr.plane.normal);
-				gi.WriteByte(self->s.skinnum);
-				gi.multicast(tr.endpos, MULTICAST_PVS);
 				break;
 			}
 
-			ignore = tr.ent;
-			VectorCopy(tr.endpos, start);
+			/* out of hits, go on behind the last one */
+			ignore = hits[numhits - 1].ent;
+			VectorCopy(tr.endpos, from);
 		}
 
-		gi.WriteByte(svc_temp_entity);
-		gi.WriteByte(TE_BFG_LASER);
-		gi.WritePosition(self->s.origin);
-		gi.WritePosition(tr.endpos);
-		gi.multicast(self->s.origin, MULTICAST_PHS);
+		/* stopped by something that's not a monster or player */
+		if (tr.ent && G_EffectVisible(tr.endpos, MULTICAST_PVS, EFFECT_SPLASH))
+		{
+			gi.WriteByte(svc_temp_entity);
+			gi.WriteByte(TE_LASER_SPARKS);
+			gi.WriteByte(4);
+			gi.WritePosition(tr.endpos);
+			gi.WriteDir(tr.plane.normal);
+			gi.WriteByte(self->s.skinnum);
+			gi.multicast(tr.endpos, MULTICAST_PVS);
+		}
+
+		if (G_EffectVisible(self->s.origin, MULTICAST_PHS, EFFECT_LINE))
+		{
+			gi.WriteByte(svc_temp_entity);
+			gi.WriteByte(TE_BFG_LASER);
+			gi.WritePosition(self->s.origin);
+			gi.WritePosition(tr.endpos);
+			gi.multicast(self->s.origin, MULTICAST_PHS);
+		}
 	}
 
 	self->nextthink = level.time + FRAMETIME;
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 1997-2001 Id Software, Inc.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ * 02111-1307, USA.
+ *
+ * =======================================================================
+ *
+ * Classnames the game code compares against. Each one becomes a
+ * CN_<classname> atom with a fixed number, see G_ClassAtom(). Only
+ * add names here, their order doesn't matter.
+ *
+ * =======================================================================
+ */
+
+CLASSNAME(debris)
+CLASSNAME(func_areaportal)
+CLASSNAME(func_door)
+CLASSNAME(func_door_rotating)
+CLASSNAME(func_timer)
+CLASSNAME(func_train)
+CLASSNAME(grenade)
+CLASSNAME(info_notnull)
+CLASSNAME(info_player_coop)
+CLASSNAME(info_player_intermission)
+CLASSNAME(info_player_start)
+CLASSNAME(key_power_cube)
+CLASSNAME(light)
+CLASSNAME(misc_explobox)
+CLASSNAME(monster_jorg)
+CLASSNAME(monster_makron)
+CLASSNAME(monster_medic)
+CLASSNAME(monster_supertank)
+CLASSNAME(monster_tank)
+CLASSNAME(path_corner)
+CLASSNAME(player_noise)
+CLASSNAME(point_combat)
+CLASSNAME(target_changelevel)
+CLASSNAME(target_crosslevel_target)
+CLASSNAME(target_crosslevel_trigger)
+CLASSNAME(target_explosion)
+CLASSNAME(target_goal)
+CLASSNAME(target_help)
+CLASSNAME(target_lightramp)
+CLASSNAME(target_secret)
+CLASSNAME(target_spawner)
+CLASSNAME(target_temp_entity)
+CLASSNAME(trigger_always)
+CLASSNAME(trigger_relay)
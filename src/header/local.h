@@ -84,6 +84,16 @@
 #define MELEE_DISTANCE 80
 #define BODY_QUEUE_SIZE 8
 
+/* classname atoms, see G_ClassAtom() */
+enum
+{
+	CN_NONE, /* NULL classname */
+#define CLASSNAME(name) CN_##name,
+#include "classnames.h"
+#undef CLASSNAME
+	CN_NUMKNOWN /* later ones are numbered as they're seen */
+};
+
 typedef enum
 {
 	DAMAGE_NO,
@@ -258,6 +268,10 @@ typedef struct gitem_s
 	int tag;
 
 	char *precaches; /* string of all models, sounds, and images this item will use */
+
+	/* bound by koiWeaponInit() */
+	int koi_behaviour; /* -1 if not a weapon under koi control */
+	int koi_ammo; /* ammo item index, 0 if none */
 } gitem_t;
 
 /* this structure is left intact through an entire game
@@ -402,11 +416,12 @@ typedef struct
 	int lastframe;
 	mframe_t *frame;
 	void (*endfunc)(edict_t *self);
+	int id; /* set by M_InitMoves(), 1 based */
 } mmove_t;
 
 typedef struct
 {
-	mmove_t *currentmove;
+	int currentmove; /* mmove_t id, 0 for none */
 	int aiflags;
 	int nextframe;
 	float scale;
@@ -496,14 +511,20 @@ extern int gibsthisframe;
 extern int meansOfDeath;
 
 extern edict_t *g_edicts;
+extern edict_t *g_clients[MAX_CLIENTS];
+extern int g_numclients;
 
 #define FOFS(x) (size_t)&(((edict_t *)NULL)->x)
 #define STOFS(x) (size_t)&(((spawn_temp_t *)NULL)->x)
 #define LLOFS(x) (size_t)&(((level_locals_t *)NULL)->x)
 #define CLOFS(x) (size_t)&(((gclient_t *)NULL)->x)
+#define MIOFS(x) (size_t)&(((monsterinfo_t *)NULL)->x)
+#define MVOFS(x) (size_t)&(((moveinfo_t *)NULL)->x)
 
 #define random() ((randk() & 0x7fff) / ((float)0x7fff))
 #define crandom() (2.0 * (random() - 0.5))
+#define random_s(s) ((randk_s(s) & 0x7fff) / ((float)0x7fff))
+#define crandom_s(s) (2.0 * (random_s(s) - 0.5))
 
 extern cvar_t *maxentities;
 extern cvar_t *deathmatch;
@@ -547,11 +568,15 @@ extern cvar_t *flood_msgs;
 extern cvar_t *flood_persecond;
 extern cvar_t *flood_waitdelay;
 
+extern cvar_t *cmd_rate;
+extern cvar_t *cmd_burst;
+
 extern cvar_t *sv_maplist;
 
 extern cvar_t *aimfix;
 extern cvar_t *g_machinegun_norecoil;
 extern cvar_t *g_swap_speed;
+extern cvar_t *g_framestats;
 
 #define world (&g_edicts[0])
 
@@ -598,6 +623,22 @@ typedef struct
 extern field_t fields[];
 extern gitem_t itemlist[];
 
+/* G_PierceTrace() passes through */
+#define PIERCE_MONSTERS 0x00000001 /* SVF_MONSTER */
+#define PIERCE_CLIENTS 0x00000002 /* players */
+#define PIERCE_BBOX 0x00000004 /* anything SOLID_BBOX */
+#define PIERCE_DAMAGEABLE 0x00000008 /* but only if it takes damage */
+#define PIERCE_CACHE 0x00000010 /* cache the world trace of ignore */
+
+#define MAX_PIERCE_HITS 32
+
+typedef struct
+{
+	edict_t *ent;
+	vec3_t endpos;
+	vec3_t normal;
+} piercehit_t;
+
 /* player/client.c */
 void ClientBegin(edict_t *ent);
 void ClientDisconnect(edict_t *ent);
@@ -608,6 +649,8 @@ void ClientThink(edict_t *ent, usercmd_t *cmd);
 /* g_cmds.c */
 void Cmd_Help_f(edict_t *ent);
 void ClientCommand(edict_t *ent);
+void G_DumpEntitiesFrame(void);
+void G_DumpEntitiesStop(void);
 
 /* g_items.c */
 void PrecacheItem(gitem_t *it);
@@ -618,6 +661,8 @@ gitem_t *FindItemByClassname(char *classname);
 
 #define ITEM_INDEX(x) ((x) - itemlist)
 
+extern int cells_index; /* cached by InitItems(), looked up every frame */
+
 edict_t *Drop_Item(edict_t *ent, gitem_t *item);
 void SetRespawn(edict_t *ent, float delay);
 void SpawnItem(edict_t *ent, gitem_t *item);
@@ -632,20 +677,52 @@ qboolean KillBox(edict_t *ent);
 void G_ProjectSource(vec3_t point, vec3_t distance, vec3_t forward,
 		vec3_t right, vec3_t result);
 edict_t *G_Find(edict_t *from, int fieldofs, char *match);
+void G_ClearTargetGraph(void);
+void G_BuildTargetGraph(void);
+void G_TargetsChanged(const char *targetname);
+void G_TargetGraphStats(void);
 edict_t *findradius(edict_t *from, vec3_t org, float rad);
+void G_InitPierceCache(void);
+void G_ClearPierceCache(void);
+int G_PierceTrace(vec3_t start, vec3_t end, edict_t *ignore, int mask,
+		int flags, piercehit_t *hits, int maxhits, trace_t *stop);
+void G_PierceStopAt(trace_t *stop, const piercehit_t *hit);
 edict_t *G_PickTarget(char *targetname);
 void G_UseTargets(edict_t *ent, edict_t *activator);
+void G_ClearDelayedUses(void);
+void G_RunDelayedUses(void);
+void G_WriteDelayedUses(FILE *f);
+void G_ReadDelayedUses(FILE *f);
 void G_SetMovedir(vec3_t angles, vec3_t movedir);
 
 void G_InitEdict(edict_t *e);
 edict_t *G_SpawnOptional(void);
 edict_t *G_Spawn(void);
 void G_FreeEdict(edict_t *e);
+edict_t *G_SpawnLogic(void);
+edict_t *G_MoveToLogic(edict_t *ent);
+void G_ClearLogicEdicts(void);
+qboolean G_IsLogicEdict(const edict_t *e);
+int G_NumForEdict(const edict_t *e);
+edict_t *G_EdictNum(int n);
+edict_t *G_EdictFrom(int n);
+edict_t *G_NextEdict(edict_t *from);
+void G_AllocMonsterInfo(edict_t *ent);
+void G_AllocMoveInfo(edict_t *ent);
+void G_ClearInfoPools(void);
+void G_ReleaseInfoBlocks(void);
+void G_InfoPoolStats(void);
 
 void G_TouchTriggers(edict_t *ent);
+void G_InitTriggerCache(void);
+void G_ClearTriggerCache(void);
+void G_ForgetTrigger(edict_t *ent);
 void G_TouchSolids(edict_t *ent);
 
 char *G_CopyString(char *in);
+void G_InitClassAtoms(void);
+int G_ClassAtom(edict_t *ent);
+const char *G_ClassAtomName(int atom);
 
 float *tv(float x, float y, float z);
 char *vtos(vec3_t v);
@@ -700,6 +777,7 @@ void monster_fire_bfg(edict_t *self, vec3_t start, vec3_t aimdir,
 		int damage, int speed, int kick, float damage_radius,
 		int flashtype);
 void M_droptofloor(edict_t *ent);
+void M_InitMoves(void);
 void monster_think(edict_t *self);
 void walkmonster_start(edict_t *self);
 void swimmonster_start(edict_t *self);
@@ -754,6 +832,7 @@ void fire_bfg(edict_t *self, vec3_t start, vec3_t dir, int damage,
 
 /* g_ptrail.c */
 void PlayerTrail_Init(void);
+void PlayerTrail_Restore(void);
 void PlayerTrail_Add(vec3_t spot);
 void PlayerTrail_New(vec3_t spot);
 edict_t *PlayerTrail_PickFirst(edict_t *self);
@@ -764,9 +843,11 @@ edict_t *PlayerTrail_LastSpot(void);
 void respawn(edict_t *ent);
 void BeginIntermission(edict_t *targ);
 void PutClientInServer(edict_t *ent);
+void G_CacheDeathmatchSpots(void);
 void InitClientPersistant(gclient_t *client);
 void InitClientResp(gclient_t *client);
 void InitBodyQue(void);
+void G_UpdateClientList(void);
 void ClientBeginServerFrame(edict_t *ent);
 
 /* g_player.c */
@@ -781,11 +862,40 @@ qboolean SV_FilterPacket(char *from);
 /* p_view.c */
 void ClientEndServerFrame(edict_t *ent);
 
+/* g_replay.c */
+void G_ReplayInit(void);
+void G_ReplayShutdown(void);
+void G_ReplayBeginLevel(const char *mapname);
+qboolean G_ReplayClientThink(edict_t *ent, usercmd_t *ucmd);
+void G_ReplayBeginFrame(void);
+void G_ReplayEndFrame(void);
+
+/* g_netstats.c */
+
+/* message sizes of the effects, for G_EffectVisible() */
+#define EFFECT_POINT 8 /* svc_temp_entity, type, position */
+#define EFFECT_POINTDIR 9 /* and a direction */
+#define EFFECT_LINE 14 /* type and two positions */
+#define EFFECT_SPLASH 11 /* count, position, direction, color */
+#define EFFECT_MUZZLEFLASH 4 /* svc, entity, flash */
+
+void G_NetStatsInit(void);
+void G_NetStatsShutdown(void);
+void G_NetStatsReset(void);
+void G_NetStatsSource(edict_t *ent);
+void G_NetStatsPush(edict_t *ent, void *func);
+void G_NetStatsPop(void);
+void G_NetStatsFrame(void);
+void G_EffectClientsMoved(void);
+qboolean G_EffectVisible(vec3_t origin, multicast_t to, int bytes);
+void SVCmd_NetStats_f(void);
+
 /* p_hud.c */
 void MoveClientToIntermission(edict_t *client);
 void G_SetStats(edict_t *ent);
 void G_SetSpectatorStats(edict_t *ent);
 void G_CheckChaseStats(edict_t *ent);
+void G_PrintStatsCounters(void);
 void ValidateSelectedItem(edict_t *ent);
 void DeathmatchScoreboardMessage(edict_t *client, edict_t *killer);
 void HelpComputerMessage(edict_t *client);
@@ -809,6 +919,8 @@ void FetchClientEntData(edict_t *ent);
 
 /* g_chase.c */
 void UpdateChaseCam(edict_t *ent);
+void SetChaseTarget(edict_t *ent, edict_t *targ);
+void ClearChasers(edict_t *ent);
 void ChaseNext(edict_t *ent);
 void ChasePrev(edict_t *ent);
 void GetChaseTarget(edict_t *ent);
@@ -819,6 +931,7 @@ void ReadLevel(const char *filename);
 void WriteLevel(const char *filename);
 void ReadGame(const char *filename);
 void WriteGame(const char *filename, qboolean autosave);
+mmove_t *GetMmoveByIndex(int index);
 void SpawnEntities(const char *mapname, char *entities, const char *spawnpoint);
 
 
@@ -884,9 +997,49 @@ typedef struct
 	int score; /* frags, etc */
 	vec3_t cmd_angles; /* angles sent over in the last command */
 
+	float cmd_tokens; /* command rate limit bucket */
+	float cmd_tokentime; /* level.time the bucket was last filled */
+	float cmd_warntime; /* no warning before this level.time */
+	int cmd_count; /* commands run */
+	int cmd_dropped; /* commands dropped by the rate limit */
+
 	qboolean spectator; /* client is a spectator */
 } client_respawn_t;
 
+/* inputs of the last G_SetStats(), a stat group is
+   only recomputed when one of its inputs changed */
+#define STATS_DIRTY_HEALTH 0x00000001
+#define STATS_DIRTY_AMMO 0x00000002
+#define STATS_DIRTY_ARMOR 0x00000004
+#define STATS_DIRTY_TIMER 0x00000008
+#define STATS_DIRTY_SELECTED 0x00000010
+#define STATS_DIRTY_HELPICON 0x00000020
+#define STATS_DIRTY_ALL 0x0000003f
+
+typedef struct
+{
+	qboolean valid; /* false forces a full recompute */
+
+	int health;
+
+	int ammo_index;
+	int ammo;
+
+	int power_armor_type;
+	int cells;
+	int armor_index;
+	int armor;
+	int armor_flash;
+
+	int timer_type;
+	int timer;
+
+	int selected_item;
+
+	int helpicon;
+	gitem_t *helpicon_weapon;
+} client_stats_t;
+
 /* this structure is cleared on each PutClientInServer(),
    except for 'client->pers' */
 struct gclient_s
@@ -944,6 +1097,8 @@ struct gclient_s
 	float wait2; /* view.c, to flash the screen if health is critical */
 	float gun_angle_inertia[3]; /* view.c, to apply inertia to gun model */
 
+	client_stats_t stats; /* hud.c, to skip unchanged stats */
+
 	/* animation vars */
 	int anim_end;
 	int anim_priority;
@@ -971,6 +1126,8 @@ struct gclient_s
 
 	edict_t *chase_target; /* player we are chasing */
 	qboolean update_chase; /* need to update chase info? */
+	edict_t *chasers; /* first player chasing us */
+	edict_t *chase_next; /* next player chasing our chase_target */
 };
 
 struct edict_s
@@ -1013,6 +1170,8 @@ struct edict_s
 	/* only used locally in game, not by server */
 	char *message;
 	char *classname;
+	int classatom; /* G_ClassAtom(), valid while classname == classatom_of */
+	char *classatom_of;
 	int spawnflags;
 
 	float timestamp;
@@ -1115,9 +1274,11 @@ struct edict_s
 
 	gitem_t *item; /* for bonus items */
 
-	/* common data blocks */
-	moveinfo_t moveinfo;
-	monsterinfo_t monsterinfo;
+	/* out of line data blocks, NULL unless allocated
+	   by G_AllocMoveInfo() or G_AllocMonsterInfo().
+	   Everything with SVF_MONSTER has a monsterinfo. */
+	moveinfo_t *moveinfo;
+	monsterinfo_t *monsterinfo;
 };
 
 /*
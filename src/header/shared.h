@@ -266,6 +266,9 @@ vec_t VectorLength(vec3_t v);
 void CrossProduct(vec3_t v1, vec3_t v2, vec3_t cross);
 vec_t VectorNormalize(vec3_t v); /* returns vector length */
 vec_t VectorNormalize2(vec3_t v, vec3_t out);
+void VectorLengthN(vec3_t *v, vec_t *out, int n);
+void VectorNormalizeN(vec3_t *v, vec_t *lengths, int n);
+void DotProductN(vec3_t *a, vec3_t *b, vec_t *out, int n);
 void VectorInverse(vec3_t v);
 void VectorScale(vec3_t in, vec_t scale, vec3_t out);
 int Q_log2(int val);
@@ -274,6 +277,7 @@ void R_ConcatRotations(float in1[3][3], float in2[3][3], float out[3][3]);
 void R_ConcatTransforms(float in1[3][4], float in2[3][4], float out[3][4]);
 
 void AngleVectors(vec3_t angles, vec3_t forward, vec3_t right, vec3_t up);
+void AngleVectorsN(vec3_t *angles, vec3_t *forward, vec3_t *right, vec3_t *up, int n);
 void AngleVectors2(vec3_t value1, vec3_t angles);
 int BoxOnPlaneSide(vec3_t emins, vec3_t emaxs, struct cplane_s *plane);
 float anglemod(float a);
@@ -325,6 +329,9 @@ int Q_stricmp(const char *s1, const char *s2);
 int Q_strcasecmp(char *s1, char *s2);
 int Q_strncasecmp(char *s1, char *s2, int n);
 
+/* portable case insensitive hash */
+unsigned int Q_strhash(const char *s);
+
 /* portable string lowercase */
 char *Q_strlwr(char *s);
 
@@ -367,10 +374,24 @@ qboolean Info_Validate(char *s);
 /* ============================================= */
 
 /* Random number generator */
+typedef enum
+{
+	RANDK_DEFAULT, /* world */
+	RANDK_AI, /* monster decisions and animation */
+	RANDK_WEAPONS, /* spread and projectiles */
+	RANDK_GIBS, /* gibs and debris, cosmetic */
+	RANDK_TEST, /* sv randtest, never used by the game */
+
+	RANDK_NUM_STREAMS
+} randk_stream_t;
+
 int randk(void);
 float frandk(void);
 float crandk(void);
-void randk_seed(void);
+int randk_s(randk_stream_t stream);
+float frandk_s(randk_stream_t stream);
+float crandk_s(randk_stream_t stream);
+void randk_seed(unsigned int seed);
 
 /*
  * ==============================================================
@@ -50,7 +50,7 @@ berserk_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("berserk/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -108,7 +108,7 @@ berserk_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_stand;
+	self->monsterinfo->currentmove = berserk_move_stand.id;
 }
 
 static mframe_t berserk_frames_stand_fidget[] = {
@@ -155,17 +155,17 @@ berserk_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() > 0.15)
+	if (random_s(RANDK_AI) > 0.15)
 	{
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_stand_fidget;
+	self->monsterinfo->currentmove = berserk_move_stand_fidget.id;
 	gi.sound(self, CHAN_WEAPON, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -200,7 +200,7 @@ berserk_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &berserk_move_walk;
+	self->monsterinfo->currentmove = berserk_move_walk.id;
 }
 
 static mframe_t berserk_frames_run1[] = {
@@ -228,13 +228,13 @@ berserk_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &berserk_move_stand;
+		self->monsterinfo->currentmove = berserk_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_run1;
+		self->monsterinfo->currentmove = berserk_move_run1.id;
 	}
 }
 
@@ -248,7 +248,7 @@ berserk_attack_spike(edict_t *self)
 		return;
 	}
 
-	fire_hit(self, aim, (15 + (randk() % 6)), 400); /*	Faster attack -- upwards and backwards */
+	fire_hit(self, aim, (15 + (randk_s(RANDK_AI) % 6)), 400); /*	Faster attack -- upwards and backwards */
 }
 
 void
@@ -292,7 +292,7 @@ berserk_attack_club(edict_t *self)
 	}
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], -4);
-	fire_hit(self, aim, (5 + (randk() % 6)), 400);       /* Slower attack */
+	fire_hit(self, aim, (5 + (randk_s(RANDK_AI) % 6)), 400);       /* Slower attack */
 }
 
 static mframe_t berserk_frames_attack_club[] = {
@@ -358,13 +358,13 @@ berserk_melee(edict_t *self)
 		return;
 	}
 
-	if ((randk() % 2) == 0)
+	if ((randk_s(RANDK_AI) % 2) == 0)
 	{
-		self->monsterinfo.currentmove = &berserk_move_attack_spike;
+		self->monsterinfo->currentmove = berserk_move_attack_spike.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_attack_club;
+		self->monsterinfo->currentmove = berserk_move_attack_club.id;
 	}
 }
 
@@ -440,13 +440,13 @@ berserk_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if ((damage < 20) || (random() < 0.5))
+	if ((damage < 20) || (random_s(RANDK_AI) < 0.5))
 	{
-		self->monsterinfo.currentmove = &berserk_move_pain1;
+		self->monsterinfo->currentmove = berserk_move_pain1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_pain2;
+		self->monsterinfo->currentmove = berserk_move_pain2.id;
 	}
 }
 
@@ -552,11 +552,11 @@ berserk_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 
 	if (damage >= 50)
 	{
-		self->monsterinfo.currentmove = &berserk_move_death1;
+		self->monsterinfo->currentmove = berserk_move_death1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &berserk_move_death2;
+		self->monsterinfo->currentmove = berserk_move_death2.id;
 	}
 }
 
@@ -577,6 +577,8 @@ SP_monster_berserk(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -603,17 +605,17 @@ SP_monster_berserk(edict_t *self)
 	self->pain = berserk_pain;
 	self->die = berserk_die;
 
-	self->monsterinfo.stand = berserk_stand;
-	self->monsterinfo.walk = berserk_walk;
-	self->monsterinfo.run = berserk_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = NULL;
-	self->monsterinfo.melee = berserk_melee;
-	self->monsterinfo.sight = berserk_sight;
-	self->monsterinfo.search = berserk_search;
-
-	self->monsterinfo.currentmove = &berserk_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->stand = berserk_stand;
+	self->monsterinfo->walk = berserk_walk;
+	self->monsterinfo->run = berserk_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = NULL;
+	self->monsterinfo->melee = berserk_melee;
+	self->monsterinfo->sight = berserk_sight;
+	self->monsterinfo->search = berserk_search;
+
+	self->monsterinfo->currentmove = berserk_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	gi.linkentity(self);
 
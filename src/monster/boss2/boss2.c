@@ -45,7 +45,7 @@ boss2_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NONE, 0);
 	}
@@ -237,7 +237,7 @@ static mframe_t boss2_frames_fidget[] = {
 mmove_t boss2_move_fidget =
 {
 	FRAME_stand1,
-	FRAME_stand30,
+	FRAME_stand29,
 	boss2_frames_fidget,
 	NULL
 };
@@ -497,7 +497,7 @@ boss2_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_stand;
+	self->monsterinfo->currentmove = boss2_move_stand.id;
 }
 
 void
@@ -508,13 +508,13 @@ boss2_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &boss2_move_stand;
+		self->monsterinfo->currentmove = boss2_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss2_move_run;
+		self->monsterinfo->currentmove = boss2_move_run.id;
 	}
 }
 
@@ -526,7 +526,7 @@ boss2_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_walk;
+	self->monsterinfo->currentmove = boss2_move_walk.id;
 }
 
 void
@@ -545,17 +545,17 @@ boss2_attack(edict_t *self)
 
 	if (range <= 125)
 	{
-		self->monsterinfo.currentmove = &boss2_move_attack_pre_mg;
+		self->monsterinfo->currentmove = boss2_move_attack_pre_mg.id;
 	}
 	else
 	{
-		if (random() <= 0.6)
+		if (random_s(RANDK_AI) <= 0.6)
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_pre_mg;
+			self->monsterinfo->currentmove = boss2_move_attack_pre_mg.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_rocket;
+			self->monsterinfo->currentmove = boss2_move_attack_rocket.id;
 		}
 	}
 }
@@ -568,7 +568,7 @@ boss2_attack_mg(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &boss2_move_attack_mg;
+	self->monsterinfo->currentmove = boss2_move_attack_mg.id;
 }
 
 void
@@ -581,18 +581,18 @@ boss2_reattack_mg(edict_t *self)
 
 	if (infront(self, self->enemy))
 	{
-		if (random() <= 0.7)
+		if (random_s(RANDK_AI) <= 0.7)
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_mg;
+			self->monsterinfo->currentmove = boss2_move_attack_mg.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &boss2_move_attack_post_mg;
+			self->monsterinfo->currentmove = boss2_move_attack_post_mg.id;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &boss2_move_attack_post_mg;
+		self->monsterinfo->currentmove = boss2_move_attack_post_mg.id;
 	}
 }
 
@@ -621,17 +621,17 @@ boss2_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage < 10)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_light;
+		self->monsterinfo->currentmove = boss2_move_pain_light.id;
 	}
 	else if (damage < 30)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_light;
+		self->monsterinfo->currentmove = boss2_move_pain_light.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &boss2_move_pain_heavy;
+		self->monsterinfo->currentmove = boss2_move_pain_heavy.id;
 	}
 }
 
@@ -664,7 +664,7 @@ boss2_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_NO;
 	self->count = 0;
-	self->monsterinfo.currentmove = &boss2_move_death;
+	self->monsterinfo->currentmove = boss2_move_death.id;
 }
 
 qboolean
@@ -710,25 +710,25 @@ Boss2_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (self->monsterinfo->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			self->monsterinfo->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			self->monsterinfo->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!self->monsterinfo->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 	{
 		return false;
 	}
@@ -738,7 +738,7 @@ Boss2_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -755,22 +755,22 @@ Boss2_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (random_s(RANDK_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		self->monsterinfo->attack_state = AS_MISSILE;
+		self->monsterinfo->attack_finished = level.time + 2 * random_s(RANDK_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (random_s(RANDK_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			self->monsterinfo->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -794,6 +794,8 @@ SP_monster_boss2(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("bosshovr/bhvpain1.wav");
 	sound_pain2 = gi.soundindex("bosshovr/bhvpain2.wav");
 	sound_pain3 = gi.soundindex("bosshovr/bhvpain3.wav");
@@ -817,16 +819,16 @@ SP_monster_boss2(edict_t *self)
 	self->pain = boss2_pain;
 	self->die = boss2_die;
 
-	self->monsterinfo.stand = boss2_stand;
-	self->monsterinfo.walk = boss2_walk;
-	self->monsterinfo.run = boss2_run;
-	self->monsterinfo.attack = boss2_attack;
-	self->monsterinfo.search = boss2_search;
-	self->monsterinfo.checkattack = Boss2_CheckAttack;
+	self->monsterinfo->stand = boss2_stand;
+	self->monsterinfo->walk = boss2_walk;
+	self->monsterinfo->run = boss2_run;
+	self->monsterinfo->attack = boss2_attack;
+	self->monsterinfo->search = boss2_search;
+	self->monsterinfo->checkattack = Boss2_CheckAttack;
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &boss2_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = boss2_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
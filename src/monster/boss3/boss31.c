@@ -58,7 +58,7 @@ jorg_search(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r <= 0.3)
 	{
@@ -199,7 +199,7 @@ jorg_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_stand;
+	self->monsterinfo->currentmove = jorg_move_stand.id;
 }
 
 static mframe_t jorg_frames_run[] = {
@@ -293,7 +293,7 @@ jorg_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_walk;
+	self->monsterinfo->currentmove = jorg_move_walk.id;
 }
 
 void
@@ -304,13 +304,13 @@ jorg_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &jorg_move_stand;
+		self->monsterinfo->currentmove = jorg_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &jorg_move_run;
+		self->monsterinfo->currentmove = jorg_move_run.id;
 	}
 }
 
@@ -524,20 +524,20 @@ jorg_reattack1(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() < 0.9)
+		if (random_s(RANDK_AI) < 0.9)
 		{
-			self->monsterinfo.currentmove = &jorg_move_attack1;
+			self->monsterinfo->currentmove = jorg_move_attack1.id;
 		}
 		else
 		{
 			self->s.sound = 0;
-			self->monsterinfo.currentmove = &jorg_move_end_attack1;
+			self->monsterinfo->currentmove = jorg_move_end_attack1.id;
 		}
 	}
 	else
 	{
 		self->s.sound = 0;
-		self->monsterinfo.currentmove = &jorg_move_end_attack1;
+		self->monsterinfo->currentmove = jorg_move_end_attack1.id;
 	}
 }
 
@@ -549,7 +549,7 @@ jorg_attack1(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &jorg_move_attack1;
+	self->monsterinfo->currentmove = jorg_move_attack1.id;
 }
 
 void
@@ -577,7 +577,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	   pain frames if he takes little damage */
 	if (damage <= 40)
 	{
-		if (random() <= 0.6)
+		if (random_s(RANDK_AI) <= 0.6)
 		{
 			return;
 		}
@@ -587,7 +587,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	   lessen the chance of him going into pain */
 	if ((self->s.frame >= FRAME_attak101) && (self->s.frame <= FRAME_attak108))
 	{
-		if (random() <= 0.005)
+		if (random_s(RANDK_AI) <= 0.005)
 		{
 			return;
 		}
@@ -595,7 +595,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 
 	if ((self->s.frame >= FRAME_attak109) && (self->s.frame <= FRAME_attak114))
 	{
-		if (random() <= 0.00005)
+		if (random_s(RANDK_AI) <= 0.00005)
 		{
 			return;
 		}
@@ -603,7 +603,7 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 
 	if ((self->s.frame >= FRAME_attak201) && (self->s.frame <= FRAME_attak208))
 	{
-		if (random() <= 0.005)
+		if (random_s(RANDK_AI) <= 0.005)
 		{
 			return;
 		}
@@ -619,19 +619,19 @@ jorg_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 50)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_pain1;
+		self->monsterinfo->currentmove = jorg_move_pain1.id;
 	}
 	else if (damage <= 100)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_pain2;
+		self->monsterinfo->currentmove = jorg_move_pain2.id;
 	}
 	else
 	{
-		if (random() <= 0.3)
+		if (random_s(RANDK_AI) <= 0.3)
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &jorg_move_pain3;
+			self->monsterinfo->currentmove = jorg_move_pain3.id;
 		}
 	}
 }
@@ -731,16 +731,16 @@ jorg_attack(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.75)
+	if (random_s(RANDK_AI) <= 0.75)
 	{
 		gi.sound(self, CHAN_VOICE, sound_attack1, 1, ATTN_NORM, 0);
 		self->s.sound = gi.soundindex("boss3/w_loop.wav");
-		self->monsterinfo.currentmove = &jorg_move_start_attack1;
+		self->monsterinfo->currentmove = jorg_move_start_attack1.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_attack2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &jorg_move_attack2;
+		self->monsterinfo->currentmove = jorg_move_attack2.id;
 	}
 }
 
@@ -764,7 +764,7 @@ jorg_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* un
 	self->takedamage = DAMAGE_NO;
 	self->s.sound = 0;
 	self->count = 0;
-	self->monsterinfo.currentmove = &jorg_move_death;
+	self->monsterinfo->currentmove = jorg_move_death.id;
 }
 
 qboolean
@@ -810,25 +810,25 @@ Jorg_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (self->monsterinfo->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			self->monsterinfo->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			self->monsterinfo->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!self->monsterinfo->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 	{
 		return false;
 	}
@@ -838,7 +838,7 @@ Jorg_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -855,22 +855,22 @@ Jorg_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (random_s(RANDK_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		self->monsterinfo->attack_state = AS_MISSILE;
+		self->monsterinfo->attack_finished = level.time + 2 * random_s(RANDK_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (random_s(RANDK_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			self->monsterinfo->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -896,6 +896,8 @@ SP_monster_jorg(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("boss3/bs3pain1.wav");
 	sound_pain2 = gi.soundindex("boss3/bs3pain2.wav");
 	sound_pain3 = gi.soundindex("boss3/bs3pain3.wav");
@@ -926,19 +928,19 @@ SP_monster_jorg(edict_t *self)
 
 	self->pain = jorg_pain;
 	self->die = jorg_die;
-	self->monsterinfo.stand = jorg_stand;
-	self->monsterinfo.walk = jorg_walk;
-	self->monsterinfo.run = jorg_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = jorg_attack;
-	self->monsterinfo.search = jorg_search;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-	self->monsterinfo.checkattack = Jorg_CheckAttack;
+	self->monsterinfo->stand = jorg_stand;
+	self->monsterinfo->walk = jorg_walk;
+	self->monsterinfo->run = jorg_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = jorg_attack;
+	self->monsterinfo->search = jorg_search;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = NULL;
+	self->monsterinfo->checkattack = Jorg_CheckAttack;
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &jorg_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = jorg_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -62,7 +62,7 @@ makron_taunt(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r <= 0.3)
 	{
@@ -157,7 +157,7 @@ makron_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &makron_move_stand;
+	self->monsterinfo->currentmove = makron_move_stand.id;
 }
 
 static mframe_t makron_frames_run[] = {
@@ -276,7 +276,7 @@ makron_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &makron_move_walk;
+	self->monsterinfo->currentmove = makron_move_walk.id;
 }
 
 void
@@ -287,13 +287,13 @@ makron_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &makron_move_stand;
+		self->monsterinfo->currentmove = makron_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &makron_move_run;
+		self->monsterinfo->currentmove = makron_move_run.id;
 	}
 }
 
@@ -741,7 +741,7 @@ makron_pain(edict_t *self, edict_t *other /* unused */,
 	/* Lessen the chance of him going into his pain frames */
 	if (damage <= 25)
 	{
-		if (random() < 0.2)
+		if (random_s(RANDK_AI) < 0.2)
 		{
 			return;
 		}
@@ -757,29 +757,29 @@ makron_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 40)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain4, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &makron_move_pain4;
+		self->monsterinfo->currentmove = makron_move_pain4.id;
 	}
 	else if (damage <= 110)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain5, 1, ATTN_NONE, 0);
-		self->monsterinfo.currentmove = &makron_move_pain5;
+		self->monsterinfo->currentmove = makron_move_pain5.id;
 	}
 	else
 	{
 		if (damage <= 150)
 		{
-			if (random() <= 0.45)
+			if (random_s(RANDK_AI) <= 0.45)
 			{
 				gi.sound(self, CHAN_VOICE, sound_pain6, 1, ATTN_NONE, 0);
-				self->monsterinfo.currentmove = &makron_move_pain6;
+				self->monsterinfo->currentmove = makron_move_pain6.id;
 			}
 		}
 		else
 		{
-			if (random() <= 0.35)
+			if (random_s(RANDK_AI) <= 0.35)
 			{
 				gi.sound(self, CHAN_VOICE, sound_pain6, 1, ATTN_NONE, 0);
-				self->monsterinfo.currentmove = &makron_move_pain6;
+				self->monsterinfo->currentmove = makron_move_pain6.id;
 			}
 		}
 	}
@@ -800,19 +800,19 @@ makron_attack(edict_t *self)
 		return;
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r <= 0.3)
 	{
-		self->monsterinfo.currentmove = &makron_move_attack3;
+		self->monsterinfo->currentmove = makron_move_attack3.id;
 	}
 	else if (r <= 0.6)
 	{
-		self->monsterinfo.currentmove = &makron_move_attack4;
+		self->monsterinfo->currentmove = makron_move_attack4.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &makron_move_attack5;
+		self->monsterinfo->currentmove = makron_move_attack5.id;
 	}
 }
 
@@ -918,6 +918,7 @@ makron_torso(edict_t *self)
 	torso->movetype = MOVETYPE_TOSS;
 	torso->solid = SOLID_BBOX;
 	torso->svflags = SVF_MONSTER|SVF_DEADMONSTER;
+	G_AllocMonsterInfo(torso);
 	torso->clipmask = MASK_MONSTERSOLID;
 	torso->s.frame = FRAME_death301;
 	torso->s.modelindex = gi.modelindex("models/monsters/boss3/rider/tris.md2");
@@ -993,7 +994,7 @@ makron_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 	self->maxs[2] = 64;
 	gi.linkentity (self);
 
-	self->monsterinfo.currentmove = &makron_move_death2;
+	self->monsterinfo->currentmove = makron_move_death2.id;
 }
 
 qboolean
@@ -1039,25 +1040,25 @@ Makron_CheckAttack(edict_t *self)
 	/* melee attack */
 	if (enemy_range == RANGE_MELEE)
 	{
-		if (self->monsterinfo.melee)
+		if (self->monsterinfo->melee)
 		{
-			self->monsterinfo.attack_state = AS_MELEE;
+			self->monsterinfo->attack_state = AS_MELEE;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_MISSILE;
+			self->monsterinfo->attack_state = AS_MISSILE;
 		}
 
 		return true;
 	}
 
 	/* missile attack */
-	if (!self->monsterinfo.attack)
+	if (!self->monsterinfo->attack)
 	{
 		return false;
 	}
 
-	if (level.time < self->monsterinfo.attack_finished)
+	if (level.time < self->monsterinfo->attack_finished)
 	{
 		return false;
 	}
@@ -1067,7 +1068,7 @@ Makron_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		chance = 0.4;
 	}
@@ -1084,22 +1085,22 @@ Makron_CheckAttack(edict_t *self)
 		return false;
 	}
 
-	if (random() < chance)
+	if (random_s(RANDK_AI) < chance)
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
-		self->monsterinfo.attack_finished = level.time + 2 * random();
+		self->monsterinfo->attack_state = AS_MISSILE;
+		self->monsterinfo->attack_finished = level.time + 2 * random_s(RANDK_AI);
 		return true;
 	}
 
 	if (self->flags & FL_FLY)
 	{
-		if (random() < 0.3)
+		if (random_s(RANDK_AI) < 0.3)
 		{
-			self->monsterinfo.attack_state = AS_SLIDING;
+			self->monsterinfo->attack_state = AS_SLIDING;
 		}
 		else
 		{
-			self->monsterinfo.attack_state = AS_STRAIGHT;
+			self->monsterinfo->attack_state = AS_STRAIGHT;
 		}
 	}
 
@@ -1144,6 +1145,8 @@ SP_monster_makron(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	MakronPrecache();
 
 	self->movetype = MOVETYPE_STEP;
@@ -1158,19 +1161,19 @@ SP_monster_makron(edict_t *self)
 
 	self->pain = makron_pain;
 	self->die = makron_die;
-	self->monsterinfo.stand = makron_stand;
-	self->monsterinfo.walk = makron_walk;
-	self->monsterinfo.run = makron_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = makron_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-	self->monsterinfo.checkattack = Makron_CheckAttack;
+	self->monsterinfo->stand = makron_stand;
+	self->monsterinfo->walk = makron_walk;
+	self->monsterinfo->run = makron_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = makron_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = NULL;
+	self->monsterinfo->checkattack = Makron_CheckAttack;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &makron_move_sight;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = makron_move_sight.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -1222,7 +1225,7 @@ MakronSpawn(edict_t *self)
 	if (enemy)
 	{
 		FoundTarget(self);
-		VectorCopy(self->pos1, self->monsterinfo.last_sighting);
+		VectorCopy(self->pos1, self->monsterinfo->last_sighting);
 	}
 
 	if (enemy && visible(self, enemy))
@@ -1246,7 +1249,7 @@ MakronSpawn(edict_t *self)
 
 	self->pain_debounce_time = level.time + 1;
 
-	self->monsterinfo.currentmove = &makron_move_sight;
+	self->monsterinfo->currentmove = makron_move_sight.id;
 }
 
 /*
@@ -1269,7 +1272,7 @@ MakronToss(edict_t *self)
 	ent->target = self->target;
 	VectorCopy(self->s.origin, ent->s.origin);
 	VectorCopy(self->s.angles, ent->s.angles);
-	VectorCopy(self->monsterinfo.last_sighting, ent->pos1);
+	VectorCopy(self->monsterinfo->last_sighting, ent->pos1);
 
 	ent->enemy = self->enemy;
 	ent->oldenemy = self->oldenemy;
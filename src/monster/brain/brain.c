@@ -58,7 +58,7 @@ brain_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("brain/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -145,7 +145,7 @@ brain_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &brain_move_stand;
+	self->monsterinfo->currentmove = brain_move_stand.id;
 }
 
 static mframe_t brain_frames_idle[] = {
@@ -200,7 +200,7 @@ brain_idle(edict_t *self)
 	}
 
 	gi.sound(self, CHAN_AUTO, sound_idle3, 1, ATTN_IDLE, 0);
-	self->monsterinfo.currentmove = &brain_move_idle;
+	self->monsterinfo->currentmove = brain_move_idle.id;
 }
 
 static mframe_t brain_frames_walk1[] = {
@@ -233,7 +233,7 @@ brain_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &brain_move_walk1;
+	self->monsterinfo->currentmove = brain_move_walk1.id;
 }
 
 static mframe_t brain_frames_defense[] = {
@@ -332,12 +332,12 @@ brain_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
 	gi.linkentity(self);
@@ -351,13 +351,13 @@ brain_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -369,7 +369,7 @@ brain_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -402,7 +402,7 @@ brain_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (random_s(RANDK_AI) > 0.25)
 	{
 		return;
 	}
@@ -413,8 +413,8 @@ brain_dodge(edict_t *self, edict_t *attacker, float eta)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.5;
-	self->monsterinfo.currentmove = &brain_move_duck;
+	self->monsterinfo->pausetime = level.time + eta + 0.5;
+	self->monsterinfo->currentmove = brain_move_duck.id;
 }
 
 static mframe_t brain_frames_death2[] = {
@@ -485,7 +485,7 @@ brain_hit_right(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->maxs[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 40))
+	if (fire_hit(self, aim, (15 + (randk_s(RANDK_AI) % 5)), 40))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_melee3, 1, ATTN_NORM, 0);
 	}
@@ -514,7 +514,7 @@ brain_hit_left(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 8);
 
-	if (fire_hit(self, aim, (15 + (randk() % 5)), 40))
+	if (fire_hit(self, aim, (15 + (randk_s(RANDK_AI) % 5)), 40))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_melee3, 1, ATTN_NORM, 0);
 	}
@@ -558,7 +558,7 @@ brain_chest_open(edict_t *self)
 	}
 
 	self->spawnflags &= ~65536;
-	self->monsterinfo.power_armor_type = POWER_ARMOR_NONE;
+	self->monsterinfo->power_armor_type = POWER_ARMOR_NONE;
 	gi.sound(self, CHAN_BODY, sound_chest_open, 1, ATTN_NORM, 0);
 }
 
@@ -574,7 +574,7 @@ brain_tentacle_attack(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, 0, 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), -600) && (skill->value > SKILL_EASY))
+	if (fire_hit(self, aim, (10 + (randk_s(RANDK_AI) % 5)), -600) && (skill->value > SKILL_EASY))
 	{
 		self->spawnflags |= 65536;
 	}
@@ -590,12 +590,12 @@ brain_chest_closed(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
+	self->monsterinfo->power_armor_type = POWER_ARMOR_SCREEN;
 
 	if (self->spawnflags & 65536)
 	{
 		self->spawnflags &= ~65536;
-		self->monsterinfo.currentmove = &brain_move_attack1;
+		self->monsterinfo->currentmove = brain_move_attack1.id;
 	}
 }
 
@@ -635,13 +635,13 @@ brain_melee(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.5)
+	if (random_s(RANDK_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &brain_move_attack1;
+		self->monsterinfo->currentmove = brain_move_attack1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_attack2;
+		self->monsterinfo->currentmove = brain_move_attack2.id;
 	}
 }
 
@@ -675,15 +675,15 @@ brain_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
+	self->monsterinfo->power_armor_type = POWER_ARMOR_SCREEN;
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &brain_move_stand;
+		self->monsterinfo->currentmove = brain_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_run;
+		self->monsterinfo->currentmove = brain_move_run.id;
 	}
 }
 
@@ -715,22 +715,22 @@ brain_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r < 0.33)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain1;
+		self->monsterinfo->currentmove = brain_move_pain1.id;
 	}
 	else if (r < 0.66)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain2;
+		self->monsterinfo->currentmove = brain_move_pain2.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &brain_move_pain3;
+		self->monsterinfo->currentmove = brain_move_pain3.id;
 	}
 }
 
@@ -762,7 +762,7 @@ brain_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	}
 
 	self->s.effects = 0;
-	self->monsterinfo.power_armor_type = POWER_ARMOR_NONE;
+	self->monsterinfo->power_armor_type = POWER_ARMOR_NONE;
 
 	/* check for gib */
 	if (self->health <= self->gib_health)
@@ -797,13 +797,13 @@ brain_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /* u
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	if (random() <= 0.5)
+	if (random_s(RANDK_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &brain_move_death1;
+		self->monsterinfo->currentmove = brain_move_death1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &brain_move_death2;
+		self->monsterinfo->currentmove = brain_move_death2.id;
 	}
 }
 
@@ -824,6 +824,8 @@ SP_monster_brain(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -857,22 +859,22 @@ SP_monster_brain(edict_t *self)
 	self->pain = brain_pain;
 	self->die = brain_die;
 
-	self->monsterinfo.stand = brain_stand;
-	self->monsterinfo.walk = brain_walk;
-	self->monsterinfo.run = brain_run;
-	self->monsterinfo.dodge = brain_dodge;
-	self->monsterinfo.melee = brain_melee;
-	self->monsterinfo.sight = brain_sight;
-	self->monsterinfo.search = brain_search;
-	self->monsterinfo.idle = brain_idle;
+	self->monsterinfo->stand = brain_stand;
+	self->monsterinfo->walk = brain_walk;
+	self->monsterinfo->run = brain_run;
+	self->monsterinfo->dodge = brain_dodge;
+	self->monsterinfo->melee = brain_melee;
+	self->monsterinfo->sight = brain_sight;
+	self->monsterinfo->search = brain_search;
+	self->monsterinfo->idle = brain_idle;
 
-	self->monsterinfo.power_armor_type = POWER_ARMOR_SCREEN;
-	self->monsterinfo.power_armor_power = 100;
+	self->monsterinfo->power_armor_type = POWER_ARMOR_SCREEN;
+	self->monsterinfo->power_armor_power = 100;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &brain_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = brain_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
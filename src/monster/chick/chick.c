@@ -68,7 +68,7 @@ chick_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("bitch/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -87,7 +87,7 @@ ChickMoan(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_idle1, 1, ATTN_IDLE, 0);
 	}
@@ -146,14 +146,14 @@ chick_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() <= 0.3)
+	if (random_s(RANDK_AI) <= 0.3)
 	{
-		self->monsterinfo.currentmove = &chick_move_fidget;
+		self->monsterinfo->currentmove = chick_move_fidget.id;
 	}
 }
 
@@ -206,7 +206,7 @@ chick_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_stand;
+	self->monsterinfo->currentmove = chick_move_stand.id;
 }
 
 static mframe_t chick_frames_start_run[] = {
@@ -280,7 +280,7 @@ chick_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_walk;
+	self->monsterinfo->currentmove = chick_move_walk.id;
 }
 
 void
@@ -291,20 +291,20 @@ chick_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &chick_move_stand;
+		self->monsterinfo->currentmove = chick_move_stand.id;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &chick_move_walk) ||
-		(self->monsterinfo.currentmove == &chick_move_start_run))
+	if ((self->monsterinfo->currentmove == chick_move_walk.id) ||
+		(self->monsterinfo->currentmove == chick_move_start_run.id))
 	{
-		self->monsterinfo.currentmove = &chick_move_run;
+		self->monsterinfo->currentmove = chick_move_run.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_start_run;
+		self->monsterinfo->currentmove = chick_move_start_run.id;
 	}
 }
 
@@ -395,7 +395,7 @@ chick_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r < 0.33)
 	{
@@ -417,15 +417,15 @@ chick_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 10)
 	{
-		self->monsterinfo.currentmove = &chick_move_pain1;
+		self->monsterinfo->currentmove = chick_move_pain1.id;
 	}
 	else if (damage <= 25)
 	{
-		self->monsterinfo.currentmove = &chick_move_pain2;
+		self->monsterinfo->currentmove = chick_move_pain2.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_pain3;
+		self->monsterinfo->currentmove = chick_move_pain3.id;
 	}
 }
 
@@ -546,14 +546,14 @@ chick_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
-		self->monsterinfo.currentmove = &chick_move_death1;
+		self->monsterinfo->currentmove = chick_move_death1.id;
 		gi.sound(self, CHAN_VOICE, sound_death1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &chick_move_death2;
+		self->monsterinfo->currentmove = chick_move_death2.id;
 		gi.sound(self, CHAN_VOICE, sound_death2, 1, ATTN_NORM, 0);
 	}
 }
@@ -566,15 +566,15 @@ chick_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
+	self->monsterinfo->pausetime = level.time + 1;
 	gi.linkentity(self);
 }
 
@@ -586,13 +586,13 @@ chick_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -604,7 +604,7 @@ chick_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -636,7 +636,7 @@ chick_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (random_s(RANDK_AI) > 0.25)
 	{
 		return;
 	}
@@ -647,7 +647,7 @@ chick_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &chick_move_duck;
+	self->monsterinfo->currentmove = chick_move_duck.id;
 }
 
 void
@@ -662,7 +662,7 @@ ChickSlash(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 10);
 	gi.sound(self, CHAN_WEAPON, sound_melee_swing, 1, ATTN_NORM, 0);
-	fire_hit(self, aim, (10 + (randk() % 6)), 100);
+	fire_hit(self, aim, (10 + (randk_s(RANDK_AI) % 6)), 100);
 }
 
 void
@@ -790,16 +790,16 @@ chick_rerocket(edict_t *self)
 		{
 			if (visible(self, self->enemy))
 			{
-				if (random() <= 0.6)
+				if (random_s(RANDK_AI) <= 0.6)
 				{
-					self->monsterinfo.currentmove = &chick_move_attack1;
+					self->monsterinfo->currentmove = chick_move_attack1.id;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &chick_move_end_attack1;
+	self->monsterinfo->currentmove = chick_move_end_attack1.id;
 }
 
 void
@@ -810,7 +810,7 @@ chick_attack1(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_attack1;
+	self->monsterinfo->currentmove = chick_move_attack1.id;
 }
 
 static mframe_t chick_frames_slash[] = {
@@ -860,20 +860,20 @@ chick_reslash(edict_t *self)
 	{
 		if (range(self, self->enemy) == RANGE_MELEE)
 		{
-			if (random() <= 0.9)
+			if (random_s(RANDK_AI) <= 0.9)
 			{
-				self->monsterinfo.currentmove = &chick_move_slash;
+				self->monsterinfo->currentmove = chick_move_slash.id;
 				return;
 			}
 			else
 			{
-				self->monsterinfo.currentmove = &chick_move_end_slash;
+				self->monsterinfo->currentmove = chick_move_end_slash.id;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &chick_move_end_slash;
+	self->monsterinfo->currentmove = chick_move_end_slash.id;
 }
 
 void
@@ -884,7 +884,7 @@ chick_slash(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_slash;
+	self->monsterinfo->currentmove = chick_move_slash.id;
 }
 
 static mframe_t chick_frames_start_slash[] = {
@@ -909,7 +909,7 @@ chick_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_start_slash;
+	self->monsterinfo->currentmove = chick_move_start_slash.id;
 }
 
 void
@@ -920,7 +920,7 @@ chick_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &chick_move_start_attack1;
+	self->monsterinfo->currentmove = chick_move_start_attack1.id;
 }
 
 void
@@ -951,6 +951,8 @@ SP_monster_chick(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -985,18 +987,18 @@ SP_monster_chick(edict_t *self)
 	self->pain = chick_pain;
 	self->die = chick_die;
 
-	self->monsterinfo.stand = chick_stand;
-	self->monsterinfo.walk = chick_walk;
-	self->monsterinfo.run = chick_run;
-	self->monsterinfo.dodge = chick_dodge;
-	self->monsterinfo.attack = chick_attack;
-	self->monsterinfo.melee = chick_melee;
-	self->monsterinfo.sight = chick_sight;
+	self->monsterinfo->stand = chick_stand;
+	self->monsterinfo->walk = chick_walk;
+	self->monsterinfo->run = chick_run;
+	self->monsterinfo->dodge = chick_dodge;
+	self->monsterinfo->attack = chick_attack;
+	self->monsterinfo->melee = chick_melee;
+	self->monsterinfo->sight = chick_sight;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &chick_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = chick_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -60,7 +60,7 @@ flipper_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_stand;
+	self->monsterinfo->currentmove = flipper_move_stand.id;
 }
 
 static mframe_t flipper_frames_run[] = {
@@ -108,7 +108,7 @@ flipper_run_loop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_run_loop;
+	self->monsterinfo->currentmove = flipper_move_run_loop.id;
 }
 
 static mframe_t flipper_frames_run_start[] = {
@@ -136,7 +136,7 @@ flipper_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_run_start;
+	self->monsterinfo->currentmove = flipper_move_run_start.id;
 }
 
 /* Standard Swimming */
@@ -183,7 +183,7 @@ flipper_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_walk;
+	self->monsterinfo->currentmove = flipper_move_walk.id;
 }
 
 static mframe_t flipper_frames_start_run[] = {
@@ -210,7 +210,7 @@ flipper_start_run(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_start_run;
+	self->monsterinfo->currentmove = flipper_move_start_run.id;
 }
 
 static mframe_t flipper_frames_pain2[] = {
@@ -308,7 +308,7 @@ flipper_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flipper_move_attack;
+	self->monsterinfo->currentmove = flipper_move_attack.id;
 }
 
 void
@@ -339,17 +339,17 @@ flipper_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = (randk() + 1) % 2;
+	n = (randk_s(RANDK_AI) + 1) % 2;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flipper_move_pain1;
+		self->monsterinfo->currentmove = flipper_move_pain1.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flipper_move_pain2;
+		self->monsterinfo->currentmove = flipper_move_pain2.id;
 	}
 }
 
@@ -506,7 +506,7 @@ flipper_die(edict_t *self, edict_t *inflictor /* unused */, edict_t *attacker /*
 	gi.sound(self, CHAN_VOICE, sound_death, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &flipper_move_death;
+	self->monsterinfo->currentmove = flipper_move_death.id;
 }
 
 /*
@@ -526,6 +526,8 @@ SP_monster_flipper(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("flipper/flppain1.wav");
 	sound_pain2 = gi.soundindex("flipper/flppain2.wav");
 	sound_death = gi.soundindex("flipper/flpdeth1.wav");
@@ -548,16 +550,16 @@ SP_monster_flipper(edict_t *self)
 	self->pain = flipper_pain;
 	self->die = flipper_die;
 
-	self->monsterinfo.stand = flipper_stand;
-	self->monsterinfo.walk = flipper_walk;
-	self->monsterinfo.run = flipper_start_run;
-	self->monsterinfo.melee = flipper_melee;
-	self->monsterinfo.sight = flipper_sight;
+	self->monsterinfo->stand = flipper_stand;
+	self->monsterinfo->walk = flipper_walk;
+	self->monsterinfo->run = flipper_start_run;
+	self->monsterinfo->melee = flipper_melee;
+	self->monsterinfo->sight = flipper_sight;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &flipper_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = flipper_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	swimmonster_start(self);
 }
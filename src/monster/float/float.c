@@ -232,13 +232,13 @@ floater_stand(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.5)
+	if (random_s(RANDK_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		self->monsterinfo->currentmove = floater_move_stand1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_stand2;
+		self->monsterinfo->currentmove = floater_move_stand2.id;
 	}
 }
 
@@ -272,6 +272,7 @@ static mframe_t floater_frames_activate[] = {
 	{ai_move, 0, NULL},
 	{ai_move, 0, NULL},
 	{ai_move, 0, NULL},
+	{ai_move, 0, NULL},
 	{ai_move, 0, NULL}
 };
 
@@ -606,13 +607,13 @@ floater_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		self->monsterinfo->currentmove = floater_move_stand1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_run;
+		self->monsterinfo->currentmove = floater_move_run.id;
 	}
 }
 
@@ -624,7 +625,7 @@ floater_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &floater_move_walk;
+	self->monsterinfo->currentmove = floater_move_walk.id;
 }
 
 void
@@ -633,7 +634,7 @@ floater_wham(edict_t *self)
 	static vec3_t aim = {MELEE_DISTANCE, 0, 0};
 
 	gi.sound(self, CHAN_WEAPON, sound_attack3, 1, ATTN_NORM, 0);
-	fire_hit(self, aim, 5 + randk() % 6, -50);
+	fire_hit(self, aim, 5 + randk_s(RANDK_AI) % 6, -50);
 }
 
 void
@@ -669,7 +670,7 @@ floater_zap(edict_t *self)
 			visible(self, self->enemy))
 	{
 		T_Damage(self->enemy, self, self, dir, self->enemy->s.origin,
-				vec3_origin, 5 + randk() % 6, -10, DAMAGE_ENERGY,
+				vec3_origin, 5 + randk_s(RANDK_AI) % 6, -10, DAMAGE_ENERGY,
 				MOD_UNKNOWN);
 	}
 }
@@ -682,7 +683,7 @@ floater_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &floater_move_attack1;
+	self->monsterinfo->currentmove = floater_move_attack1.id;
 }
 
 void
@@ -693,13 +694,13 @@ floater_melee(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_attack3;
+		self->monsterinfo->currentmove = floater_move_attack3.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_attack2;
+		self->monsterinfo->currentmove = floater_move_attack2.id;
 	}
 }
 
@@ -731,17 +732,17 @@ floater_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = (randk() + 1) % 3;
+	n = (randk_s(RANDK_AI) + 1) % 3;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &floater_move_pain1;
+		self->monsterinfo->currentmove = floater_move_pain1.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &floater_move_pain2;
+		self->monsterinfo->currentmove = floater_move_pain2.id;
 	}
 }
 
@@ -791,6 +792,8 @@ SP_monster_floater(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_attack2 = gi.soundindex("floater/fltatck2.wav");
 	sound_attack3 = gi.soundindex("floater/fltatck3.wav");
 	sound_death1 = gi.soundindex("floater/fltdeth1.wav");
@@ -816,26 +819,26 @@ SP_monster_floater(edict_t *self)
 	self->pain = floater_pain;
 	self->die = floater_die;
 
-	self->monsterinfo.stand = floater_stand;
-	self->monsterinfo.walk = floater_walk;
-	self->monsterinfo.run = floater_run;
-	self->monsterinfo.attack = floater_attack;
-	self->monsterinfo.melee = floater_melee;
-	self->monsterinfo.sight = floater_sight;
-	self->monsterinfo.idle = floater_idle;
+	self->monsterinfo->stand = floater_stand;
+	self->monsterinfo->walk = floater_walk;
+	self->monsterinfo->run = floater_run;
+	self->monsterinfo->attack = floater_attack;
+	self->monsterinfo->melee = floater_melee;
+	self->monsterinfo->sight = floater_sight;
+	self->monsterinfo->idle = floater_idle;
 
 	gi.linkentity(self);
 
-	if (random() <= 0.5)
+	if (random_s(RANDK_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &floater_move_stand1;
+		self->monsterinfo->currentmove = floater_move_stand1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &floater_move_stand2;
+		self->monsterinfo->currentmove = floater_move_stand2.id;
 	}
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -255,13 +255,13 @@ flyer_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &flyer_move_stand;
+		self->monsterinfo->currentmove = flyer_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &flyer_move_run;
+		self->monsterinfo->currentmove = flyer_move_run.id;
 	}
 }
 
@@ -273,7 +273,7 @@ flyer_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_walk;
+	self->monsterinfo->currentmove = flyer_move_walk.id;
 }
 
 void
@@ -284,7 +284,7 @@ flyer_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_stand;
+	self->monsterinfo->currentmove = flyer_move_stand.id;
 }
 
 static mframe_t flyer_frames_start[] = {
@@ -330,7 +330,7 @@ flyer_stop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_stop;
+	self->monsterinfo->currentmove = flyer_move_stop.id;
 }
 
 void
@@ -341,7 +341,7 @@ flyer_start(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_start;
+	self->monsterinfo->currentmove = flyer_move_start.id;
 }
 
 static mframe_t flyer_frames_rollright[] = {
@@ -665,7 +665,7 @@ flyer_loop_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_loop_melee;
+	self->monsterinfo->currentmove = flyer_move_loop_melee.id;
 }
 
 void
@@ -676,7 +676,7 @@ flyer_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_attack2;
+	self->monsterinfo->currentmove = flyer_move_attack2.id;
 }
 
 void
@@ -688,7 +688,7 @@ flyer_setstart(edict_t *self)
 	}
 
 	nextmove = ACTION_run;
-	self->monsterinfo.currentmove = &flyer_move_start;
+	self->monsterinfo->currentmove = flyer_move_start.id;
 }
 
 void
@@ -701,15 +701,15 @@ flyer_nextmove(edict_t *self)
 
 	if (nextmove == ACTION_attack1)
 	{
-		self->monsterinfo.currentmove = &flyer_move_start_melee;
+		self->monsterinfo->currentmove = flyer_move_start_melee.id;
 	}
 	else if (nextmove == ACTION_attack2)
 	{
-		self->monsterinfo.currentmove = &flyer_move_attack2;
+		self->monsterinfo->currentmove = flyer_move_attack2.id;
 	}
 	else if (nextmove == ACTION_run)
 	{
-		self->monsterinfo.currentmove = &flyer_move_run;
+		self->monsterinfo->currentmove = flyer_move_run.id;
 	}
 }
 
@@ -721,7 +721,7 @@ flyer_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &flyer_move_start_melee;
+	self->monsterinfo->currentmove = flyer_move_start_melee.id;
 }
 
 void
@@ -734,18 +734,18 @@ flyer_check_melee(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		if (random() <= 0.8)
+		if (random_s(RANDK_AI) <= 0.8)
 		{
-			self->monsterinfo.currentmove = &flyer_move_loop_melee;
+			self->monsterinfo->currentmove = flyer_move_loop_melee.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &flyer_move_end_melee;
+			self->monsterinfo->currentmove = flyer_move_end_melee.id;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &flyer_move_end_melee;
+		self->monsterinfo->currentmove = flyer_move_end_melee.id;
 	}
 }
 
@@ -777,22 +777,22 @@ flyer_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	n = randk() % 3;
+	n = randk_s(RANDK_AI) % 3;
 
 	if (n == 0)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain1;
+		self->monsterinfo->currentmove = flyer_move_pain1.id;
 	}
 	else if (n == 1)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain2;
+		self->monsterinfo->currentmove = flyer_move_pain2.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &flyer_move_pain3;
+		self->monsterinfo->currentmove = flyer_move_pain3.id;
 	}
 }
 
@@ -827,11 +827,14 @@ SP_monster_flyer(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	/* fix a map bug in jail5.bsp */
 	if (!Q_stricmp(level.mapname, "jail5") && (self->s.origin[2] == -104))
 	{
 		self->targetname = self->target;
 		self->target = NULL;
+		G_TargetsChanged(self->targetname);
 	}
 
 	sound_sight = gi.soundindex("flyer/flysght1.wav");
@@ -858,18 +861,18 @@ SP_monster_flyer(edict_t *self)
 	self->pain = flyer_pain;
 	self->die = flyer_die;
 
-	self->monsterinfo.stand = flyer_stand;
-	self->monsterinfo.walk = flyer_walk;
-	self->monsterinfo.run = flyer_run;
-	self->monsterinfo.attack = flyer_attack;
-	self->monsterinfo.melee = flyer_melee;
-	self->monsterinfo.sight = flyer_sight;
-	self->monsterinfo.idle = flyer_idle;
+	self->monsterinfo->stand = flyer_stand;
+	self->monsterinfo->walk = flyer_walk;
+	self->monsterinfo->run = flyer_run;
+	self->monsterinfo->attack = flyer_attack;
+	self->monsterinfo->melee = flyer_melee;
+	self->monsterinfo->sight = flyer_sight;
+	self->monsterinfo->idle = flyer_idle;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &flyer_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = flyer_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
@@ -54,7 +54,7 @@ gladiator_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("gladiator/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -134,7 +134,7 @@ gladiator_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_stand;
+	self->monsterinfo->currentmove = gladiator_move_stand.id;
 }
 
 static mframe_t gladiator_frames_walk[] = {
@@ -172,7 +172,7 @@ gladiator_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_walk;
+	self->monsterinfo->currentmove = gladiator_move_walk.id;
 }
 
 static mframe_t gladiator_frames_run[] = {
@@ -200,13 +200,13 @@ gladiator_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &gladiator_move_stand;
+		self->monsterinfo->currentmove = gladiator_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladiator_move_run;
+		self->monsterinfo->currentmove = gladiator_move_run.id;
 	}
 }
 
@@ -222,7 +222,7 @@ GaldiatorMelee(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], -4);
 
-	if (fire_hit(self, aim, (20 + (randk() % 5)), 300))
+	if (fire_hit(self, aim, (20 + (randk_s(RANDK_AI) % 5)), 300))
 	{
 		gi.sound(self, CHAN_AUTO, sound_cleaver_hit, 1, ATTN_NORM, 0);
 	}
@@ -268,7 +268,7 @@ gladiator_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gladiator_move_attack_melee;
+	self->monsterinfo->currentmove = gladiator_move_attack_melee.id;
 }
 
 void
@@ -329,7 +329,7 @@ gladiator_attack(edict_t *self)
 	   but not for stand-ground ones since players can
 	   abuse it by standing still inside this range
 	*/
-	if (!(self->monsterinfo.aiflags & AI_STAND_GROUND))
+	if (!(self->monsterinfo->aiflags & AI_STAND_GROUND))
 	{
 		VectorSubtract(self->s.origin, self->enemy->s.origin, v);
 		range = VectorLength(v);
@@ -344,7 +344,7 @@ gladiator_attack(edict_t *self)
 	gi.sound(self, CHAN_WEAPON, sound_gun, 1, ATTN_NORM, 0);
 	VectorCopy(self->enemy->s.origin, self->pos1); /* save for aiming the shot */
 	self->pos1[2] += self->enemy->viewheight;
-	self->monsterinfo.currentmove = &gladiator_move_attack_gun;
+	self->monsterinfo->currentmove = gladiator_move_attack_gun.id;
 }
 
 static mframe_t gladiator_frames_pain[] = {
@@ -399,9 +399,9 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			(self->monsterinfo.currentmove == &gladiator_move_pain))
+			(self->monsterinfo->currentmove == gladiator_move_pain.id))
 		{
-			self->monsterinfo.currentmove = &gladiator_move_pain_air;
+			self->monsterinfo->currentmove = gladiator_move_pain_air.id;
 		}
 
 		return;
@@ -409,7 +409,7 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
@@ -425,11 +425,11 @@ gladiator_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &gladiator_move_pain_air;
+		self->monsterinfo->currentmove = gladiator_move_pain_air.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gladiator_move_pain;
+		self->monsterinfo->currentmove = gladiator_move_pain.id;
 	}
 }
 
@@ -527,7 +527,7 @@ gladiator_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &gladiator_move_death;
+	self->monsterinfo->currentmove = gladiator_move_death.id;
 }
 
 /*
@@ -547,6 +547,8 @@ SP_monster_gladiator(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -576,19 +578,19 @@ SP_monster_gladiator(edict_t *self)
 	self->pain = gladiator_pain;
 	self->die = gladiator_die;
 
-	self->monsterinfo.stand = gladiator_stand;
-	self->monsterinfo.walk = gladiator_walk;
-	self->monsterinfo.run = gladiator_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = gladiator_attack;
-	self->monsterinfo.melee = gladiator_melee;
-	self->monsterinfo.sight = gladiator_sight;
-	self->monsterinfo.idle = gladiator_idle;
-	self->monsterinfo.search = gladiator_search;
+	self->monsterinfo->stand = gladiator_stand;
+	self->monsterinfo->walk = gladiator_walk;
+	self->monsterinfo->run = gladiator_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = gladiator_attack;
+	self->monsterinfo->melee = gladiator_melee;
+	self->monsterinfo->sight = gladiator_sight;
+	self->monsterinfo->idle = gladiator_idle;
+	self->monsterinfo->search = gladiator_search;
 
 	gi.linkentity(self);
-	self->monsterinfo.currentmove = &gladiator_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = gladiator_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
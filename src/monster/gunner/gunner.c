@@ -51,7 +51,7 @@ gunner_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("gunner/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -180,14 +180,14 @@ gunner_fidget(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
 		return;
 	}
 
-	if (random() <= 0.05)
+	if (random_s(RANDK_AI) <= 0.05)
 	{
-		self->monsterinfo.currentmove = &gunner_move_fidget;
+		self->monsterinfo->currentmove = gunner_move_fidget.id;
 	}
 }
 
@@ -242,7 +242,7 @@ gunner_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_stand;
+	self->monsterinfo->currentmove = gunner_move_stand.id;
 }
 
 static mframe_t gunner_frames_walk[] = {
@@ -277,7 +277,7 @@ gunner_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_walk;
+	self->monsterinfo->currentmove = gunner_move_walk.id;
 }
 
 static mframe_t gunner_frames_run[] = {
@@ -307,13 +307,13 @@ gunner_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &gunner_move_stand;
+		self->monsterinfo->currentmove = gunner_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gunner_move_run;
+		self->monsterinfo->currentmove = gunner_move_run.id;
 	}
 }
 
@@ -342,7 +342,7 @@ gunner_runandshoot(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_runandshoot;
+	self->monsterinfo->currentmove = gunner_move_runandshoot.id;
 }
 
 static mframe_t gunner_frames_pain3[] = {
@@ -430,7 +430,7 @@ gunner_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	if (randk() & 1)
+	if (randk_s(RANDK_AI) & 1)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain, 1, ATTN_NORM, 0);
 	}
@@ -446,15 +446,15 @@ gunner_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 10)
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain3;
+		self->monsterinfo->currentmove = gunner_move_pain3.id;
 	}
 	else if (damage <= 25)
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain2;
+		self->monsterinfo->currentmove = gunner_move_pain2.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &gunner_move_pain1;
+		self->monsterinfo->currentmove = gunner_move_pain1.id;
 	}
 }
 
@@ -542,7 +542,7 @@ gunner_die(edict_t *self, edict_t *inflictor /* unused */,
 	gi.sound(self, CHAN_VOICE, sound_death, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &gunner_move_death;
+	self->monsterinfo->currentmove = gunner_move_death.id;
 }
 
 void
@@ -553,16 +553,16 @@ gunner_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 
 	if (skill->value >= SKILL_HARD)
 	{
-		if (random() > 0.5)
+		if (random_s(RANDK_AI) > 0.5)
 		{
 			GunnerGrenade(self);
 		}
@@ -570,7 +570,7 @@ gunner_duck_down(edict_t *self)
 
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
+	self->monsterinfo->pausetime = level.time + 1;
 	gi.linkentity(self);
 }
 
@@ -582,13 +582,13 @@ gunner_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -600,7 +600,7 @@ gunner_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -633,7 +633,7 @@ gunner_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (random_s(RANDK_AI) > 0.25)
 	{
 		return;
 	}
@@ -644,7 +644,7 @@ gunner_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_duck;
+	self->monsterinfo->currentmove = gunner_move_duck.id;
 }
 
 void
@@ -826,17 +826,17 @@ gunner_attack(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		self->monsterinfo.currentmove = &gunner_move_attack_chain;
+		self->monsterinfo->currentmove = gunner_move_attack_chain.id;
 	}
 	else
 	{
-		if (random() <= 0.5)
+		if (random_s(RANDK_AI) <= 0.5)
 		{
-			self->monsterinfo.currentmove = &gunner_move_attack_grenade;
+			self->monsterinfo->currentmove = gunner_move_attack_grenade.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &gunner_move_attack_chain;
+			self->monsterinfo->currentmove = gunner_move_attack_chain.id;
 		}
 	}
 }
@@ -849,7 +849,7 @@ gunner_fire_chain(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_fire_chain;
+	self->monsterinfo->currentmove = gunner_move_fire_chain.id;
 }
 
 void
@@ -864,15 +864,15 @@ gunner_refire_chain(edict_t *self)
 	{
 		if (visible(self, self->enemy))
 		{
-			if (random() <= 0.5)
+			if (random_s(RANDK_AI) <= 0.5)
 			{
-				self->monsterinfo.currentmove = &gunner_move_fire_chain;
+				self->monsterinfo->currentmove = gunner_move_fire_chain.id;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &gunner_move_endfire_chain;
+	self->monsterinfo->currentmove = gunner_move_endfire_chain.id;
 }
 
 /*
@@ -892,6 +892,8 @@ SP_monster_gunner(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -921,19 +923,19 @@ SP_monster_gunner(edict_t *self)
 	self->pain = gunner_pain;
 	self->die = gunner_die;
 
-	self->monsterinfo.stand = gunner_stand;
-	self->monsterinfo.walk = gunner_walk;
-	self->monsterinfo.run = gunner_run;
-	self->monsterinfo.dodge = gunner_dodge;
-	self->monsterinfo.attack = gunner_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = gunner_sight;
-	self->monsterinfo.search = gunner_search;
+	self->monsterinfo->stand = gunner_stand;
+	self->monsterinfo->walk = gunner_walk;
+	self->monsterinfo->run = gunner_run;
+	self->monsterinfo->dodge = gunner_dodge;
+	self->monsterinfo->attack = gunner_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = gunner_sight;
+	self->monsterinfo->search = gunner_search;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &gunner_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = gunner_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
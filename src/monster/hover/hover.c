@@ -52,7 +52,7 @@ void
 hover_search(edict_t *self)
 
 {
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NORM, 0);
 	}
@@ -534,15 +534,15 @@ hover_reattack(edict_t *self)
 	{
 		if (visible(self, self->enemy))
 		{
-			if (random() <= 0.6)
+			if (random_s(RANDK_AI) <= 0.6)
 			{
-				self->monsterinfo.currentmove = &hover_move_attack1;
+				self->monsterinfo->currentmove = hover_move_attack1.id;
 				return;
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &hover_move_end_attack;
+	self->monsterinfo->currentmove = hover_move_end_attack.id;
 }
 
 void
@@ -587,7 +587,7 @@ hover_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_stand;
+	self->monsterinfo->currentmove = hover_move_stand.id;
 }
 
 void
@@ -598,13 +598,13 @@ hover_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &hover_move_stand;
+		self->monsterinfo->currentmove = hover_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &hover_move_run;
+		self->monsterinfo->currentmove = hover_move_run.id;
 	}
 }
 
@@ -616,7 +616,7 @@ hover_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_walk;
+	self->monsterinfo->currentmove = hover_move_walk.id;
 }
 
 void
@@ -627,7 +627,7 @@ hover_start_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_start_attack;
+	self->monsterinfo->currentmove = hover_move_start_attack.id;
 }
 
 void
@@ -638,7 +638,7 @@ hover_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &hover_move_attack1;
+	self->monsterinfo->currentmove = hover_move_attack1.id;
 }
 
 void
@@ -669,21 +669,21 @@ hover_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (damage <= 25)
 	{
-		if (random() < 0.5)
+		if (random_s(RANDK_AI) < 0.5)
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &hover_move_pain3;
+			self->monsterinfo->currentmove = hover_move_pain3.id;
 		}
 		else
 		{
 			gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-			self->monsterinfo.currentmove = &hover_move_pain2;
+			self->monsterinfo->currentmove = hover_move_pain2.id;
 		}
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &hover_move_pain1;
+		self->monsterinfo->currentmove = hover_move_pain1.id;
 	}
 }
 
@@ -769,7 +769,7 @@ hover_die(edict_t *self, edict_t *inflictor /* unused */,
 	}
 
 	/* regular death */
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_death1, 1, ATTN_NORM, 0);
 	}
@@ -780,7 +780,7 @@ hover_die(edict_t *self, edict_t *inflictor /* unused */,
 
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &hover_move_death1;
+	self->monsterinfo->currentmove = hover_move_death1.id;
 }
 
 /*
@@ -800,6 +800,8 @@ SP_monster_hover(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("hover/hovpain1.wav");
 	sound_pain2 = gi.soundindex("hover/hovpain2.wav");
 	sound_death1 = gi.soundindex("hover/hovdeth1.wav");
@@ -825,17 +827,17 @@ SP_monster_hover(edict_t *self)
 	self->pain = hover_pain;
 	self->die = hover_die;
 
-	self->monsterinfo.stand = hover_stand;
-	self->monsterinfo.walk = hover_walk;
-	self->monsterinfo.run = hover_run;
-	self->monsterinfo.attack = hover_start_attack;
-	self->monsterinfo.sight = hover_sight;
-	self->monsterinfo.search = hover_search;
+	self->monsterinfo->stand = hover_stand;
+	self->monsterinfo->walk = hover_walk;
+	self->monsterinfo->run = hover_run;
+	self->monsterinfo->attack = hover_start_attack;
+	self->monsterinfo->sight = hover_sight;
+	self->monsterinfo->search = hover_search;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &hover_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = hover_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	flymonster_start(self);
 }
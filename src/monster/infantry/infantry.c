@@ -58,7 +58,7 @@ infantry_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("infantry/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -110,7 +110,7 @@ infantry_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_stand;
+	self->monsterinfo->currentmove = infantry_move_stand.id;
 }
 
 static mframe_t infantry_frames_fidget[] = {
@@ -181,7 +181,7 @@ infantry_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_fidget;
+	self->monsterinfo->currentmove = infantry_move_fidget.id;
 	gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -216,7 +216,7 @@ infantry_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_walk;
+	self->monsterinfo->currentmove = infantry_move_walk.id;
 }
 
 static mframe_t infantry_frames_run[] = {
@@ -241,13 +241,13 @@ mmove_t infantry_move_run =
 void
 infantry_run(edict_t *self)
 {
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &infantry_move_stand;
+		self->monsterinfo->currentmove = infantry_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_run;
+		self->monsterinfo->currentmove = infantry_move_run.id;
 	}
 }
 
@@ -319,14 +319,14 @@ infantry_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
-		self->monsterinfo.currentmove = &infantry_move_pain1;
+		self->monsterinfo->currentmove = infantry_move_pain1.id;
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_pain2;
+		self->monsterinfo->currentmove = infantry_move_pain2.id;
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 }
@@ -557,21 +557,21 @@ infantry_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->takedamage = DAMAGE_YES;
 	self->s.skinnum = 1; /* switch to bloody skin */
 
-	n = randk() % 3;
+	n = randk_s(RANDK_AI) % 3;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &infantry_move_death1;
+		self->monsterinfo->currentmove = infantry_move_death1.id;
 		gi.sound(self, CHAN_VOICE, sound_die2, 1, ATTN_NORM, 0);
 	}
 	else if (n == 1)
 	{
-		self->monsterinfo.currentmove = &infantry_move_death2;
+		self->monsterinfo->currentmove = infantry_move_death2.id;
 		gi.sound(self, CHAN_VOICE, sound_die1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_death3;
+		self->monsterinfo->currentmove = infantry_move_death3.id;
 		gi.sound(self, CHAN_VOICE, sound_die2, 1, ATTN_NORM, 0);
 	}
 }
@@ -584,15 +584,15 @@ infantry_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
+	self->monsterinfo->pausetime = level.time + 1;
 	gi.linkentity(self);
 }
 
@@ -604,13 +604,13 @@ infantry_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -622,7 +622,7 @@ infantry_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -652,7 +652,7 @@ infantry_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (random_s(RANDK_AI) > 0.25)
 	{
 		return;
 	}
@@ -663,7 +663,7 @@ infantry_dodge(edict_t *self, edict_t *attacker, float eta /* unused */)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &infantry_move_duck;
+	self->monsterinfo->currentmove = infantry_move_duck.id;
 }
 
 void
@@ -677,8 +677,8 @@ infantry_cock_gun(edict_t *self)
 	}
 
 	gi.sound(self, CHAN_WEAPON, sound_weapon_cock, 1, ATTN_NORM, 0);
-	n = (randk() & 15) + 3 + 7;
-	self->monsterinfo.pausetime = level.time + n * FRAMETIME;
+	n = (randk_s(RANDK_AI) & 15) + 3 + 7;
+	self->monsterinfo->pausetime = level.time + n * FRAMETIME;
 }
 
 void
@@ -691,13 +691,13 @@ infantry_fire(edict_t *self)
 
 	InfantryMachineGun(self);
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -750,7 +750,7 @@ infantry_smack(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, 0, 0);
 
-	if (fire_hit(self, aim, (5 + (randk() % 5)), 50))
+	if (fire_hit(self, aim, (5 + (randk_s(RANDK_AI) % 5)), 50))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_punch_hit, 1, ATTN_NORM, 0);
 	}
@@ -785,11 +785,11 @@ infantry_attack(edict_t *self)
 
 	if (range(self, self->enemy) == RANGE_MELEE)
 	{
-		self->monsterinfo.currentmove = &infantry_move_attack2;
+		self->monsterinfo->currentmove = infantry_move_attack2.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &infantry_move_attack1;
+		self->monsterinfo->currentmove = infantry_move_attack1.id;
 	}
 }
 
@@ -810,6 +810,8 @@ SP_monster_infantry(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -842,19 +844,19 @@ SP_monster_infantry(edict_t *self)
 	self->pain = infantry_pain;
 	self->die = infantry_die;
 
-	self->monsterinfo.stand = infantry_stand;
-	self->monsterinfo.walk = infantry_walk;
-	self->monsterinfo.run = infantry_run;
-	self->monsterinfo.dodge = infantry_dodge;
-	self->monsterinfo.attack = infantry_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = infantry_sight;
-	self->monsterinfo.idle = infantry_fidget;
+	self->monsterinfo->stand = infantry_stand;
+	self->monsterinfo->walk = infantry_walk;
+	self->monsterinfo->run = infantry_run;
+	self->monsterinfo->dodge = infantry_dodge;
+	self->monsterinfo->attack = infantry_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = infantry_sight;
+	self->monsterinfo->idle = infantry_fidget;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &infantry_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = infantry_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
@@ -55,7 +55,7 @@ insane_footstep(edict_t *self)
 	}
 
 	int     i;
-	i = randk() % 4;
+	i = randk_s(RANDK_AI) % 4;
 
 	if (i == 0)
 	{
@@ -129,7 +129,7 @@ insane_scream(edict_t *self)
 		return;
 	}
 
-	gi.sound(self, CHAN_VOICE, sound_scream[randk() % 8], 1, ATTN_IDLE, 0);
+	gi.sound(self, CHAN_VOICE, sound_scream[randk_s(RANDK_AI) % 8], 1, ATTN_IDLE, 0);
 }
 
 void insane_stand(edict_t *self);
@@ -623,13 +623,13 @@ insane_cross(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.8)
+	if (random_s(RANDK_AI) < 0.8)
 	{
-		self->monsterinfo.currentmove = &insane_move_cross;
+		self->monsterinfo->currentmove = insane_move_cross.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_struggle_cross;
+		self->monsterinfo->currentmove = insane_move_struggle_cross.id;
 	}
 }
 
@@ -645,23 +645,23 @@ insane_walk(edict_t *self)
 	{
 		if (self->s.frame == FRAME_cr_pain10)
 		{
-			self->monsterinfo.currentmove = &insane_move_down;
+			self->monsterinfo->currentmove = insane_move_down.id;
 			return;
 		}
 	}
 
 	if (self->spawnflags & 4)
 	{
-		self->monsterinfo.currentmove = &insane_move_crawl;
+		self->monsterinfo->currentmove = insane_move_crawl.id;
 	}
 	else
-	if (random() <= 0.5)
+	if (random_s(RANDK_AI) <= 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_walk_normal;
+		self->monsterinfo->currentmove = insane_move_walk_normal.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_walk_insane;
+		self->monsterinfo->currentmove = insane_move_walk_insane.id;
 	}
 }
 
@@ -677,22 +677,22 @@ insane_run(edict_t *self)
 	{
 		if (self->s.frame == FRAME_cr_pain10)
 		{
-			self->monsterinfo.currentmove = &insane_move_down;
+			self->monsterinfo->currentmove = insane_move_down.id;
 			return;
 		}
 	}
 
 	if (self->spawnflags & 4)
 	{
-		self->monsterinfo.currentmove = &insane_move_runcrawl;
+		self->monsterinfo->currentmove = insane_move_runcrawl.id;
 	}
-	else if (frandk() <= 0.5) /* Else, mix it up */
+	else if (frandk_s(RANDK_AI) <= 0.5) /* Else, mix it up */
 	{
-		self->monsterinfo.currentmove = &insane_move_run_normal;
+		self->monsterinfo->currentmove = insane_move_run_normal.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_run_insane;
+		self->monsterinfo->currentmove = insane_move_run_insane.id;
 	}
 }
 
@@ -714,7 +714,7 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 
 	self->pain_debounce_time = level.time + 3;
 
-	r = 1 + (randk() & 1);
+	r = 1 + (randk_s(RANDK_AI) & 1);
 
 	if (self->health < 25)
 	{
@@ -747,7 +747,7 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 	/* Don't go into pain frames if crucified. */
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED)
 	{
-		self->monsterinfo.currentmove = &insane_move_struggle_cross;
+		self->monsterinfo->currentmove = insane_move_struggle_cross.id;
 		return;
 	}
 
@@ -756,11 +756,11 @@ insane_pain(edict_t *self, edict_t *other /* unused */,
 		((self->s.frame >= FRAME_stand99) &&
 		 (self->s.frame <= FRAME_stand160)))
 	{
-		self->monsterinfo.currentmove = &insane_move_crawl_pain;
+		self->monsterinfo->currentmove = insane_move_crawl_pain.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_pain;
+		self->monsterinfo->currentmove = insane_move_stand_pain.id;
 	}
 }
 
@@ -772,7 +772,7 @@ insane_onground(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &insane_move_down;
+	self->monsterinfo->currentmove = insane_move_down.id;
 }
 
 void
@@ -788,15 +788,15 @@ insane_checkdown(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.3)
+	if (random_s(RANDK_AI) < 0.3)
 	{
-		if (random() < 0.5)
+		if (random_s(RANDK_AI) < 0.5)
 		{
-			self->monsterinfo.currentmove = &insane_move_uptodown;
+			self->monsterinfo->currentmove = insane_move_uptodown.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &insane_move_jumpdown;
+			self->monsterinfo->currentmove = insane_move_jumpdown.id;
 		}
 	}
 }
@@ -815,9 +815,9 @@ insane_checkup(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_downtoup;
+		self->monsterinfo->currentmove = insane_move_downtoup.id;
 	}
 }
 
@@ -831,22 +831,22 @@ insane_stand(edict_t *self)
 
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED) /* If crucified */
 	{
-		self->monsterinfo.currentmove = &insane_move_cross;
-		self->monsterinfo.aiflags |= AI_STAND_GROUND;
+		self->monsterinfo->currentmove = insane_move_cross.id;
+		self->monsterinfo->aiflags |= AI_STAND_GROUND;
 	}
 	/* If Hold_Ground and Crawl are set */
 	else if ((self->spawnflags & 4) && (self->spawnflags & 16))
 	{
-		self->monsterinfo.currentmove = &insane_move_down;
+		self->monsterinfo->currentmove = insane_move_down.id;
 	}
 	else
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_normal;
+		self->monsterinfo->currentmove = insane_move_stand_normal.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &insane_move_stand_insane;
+		self->monsterinfo->currentmove = insane_move_stand_insane.id;
 	}
 }
 
@@ -914,7 +914,7 @@ insane_die(edict_t *self, edict_t *inflictor /* unused */,
 	}
 
 	gi.sound(self, CHAN_VOICE, gi.soundindex(va("player/male/death%i.wav",
-							(randk() % 4) + 1)), 1, ATTN_IDLE, 0);
+							(randk_s(RANDK_AI) % 4) + 1)), 1, ATTN_IDLE, 0);
 
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
@@ -930,11 +930,11 @@ insane_die(edict_t *self, edict_t *inflictor /* unused */,
 			((self->s.frame >= FRAME_stand99) &&
 			 (self->s.frame <= FRAME_stand160)))
 		{
-			self->monsterinfo.currentmove = &insane_move_crawl_death;
+			self->monsterinfo->currentmove = insane_move_crawl_death.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &insane_move_stand_death;
+			self->monsterinfo->currentmove = insane_move_stand_death.id;
 		}
 	}
 }
@@ -956,6 +956,8 @@ SP_misc_insane(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -989,25 +991,25 @@ SP_misc_insane(edict_t *self)
 	self->pain = insane_pain;
 	self->die = insane_die;
 
-	self->monsterinfo.stand = insane_stand;
-	self->monsterinfo.walk = insane_walk;
-	self->monsterinfo.run = insane_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = NULL;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
-	self->monsterinfo.aiflags |= AI_GOOD_GUY;
+	self->monsterinfo->stand = insane_stand;
+	self->monsterinfo->walk = insane_walk;
+	self->monsterinfo->run = insane_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = NULL;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = NULL;
+	self->monsterinfo->aiflags |= AI_GOOD_GUY;
 
 	gi.linkentity(self);
 
 	if (self->spawnflags & 16) /* Stand Ground */
 	{
-		self->monsterinfo.aiflags |= AI_STAND_GROUND;
+		self->monsterinfo->aiflags |= AI_STAND_GROUND;
 	}
 
-	self->monsterinfo.currentmove = &insane_move_stand_normal;
+	self->monsterinfo->currentmove = insane_move_stand_normal.id;
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	if (self->spawnflags & SPAWNFLAG_CRUSIFIED) /* Crucified ? */
 	{
@@ -1019,6 +1021,6 @@ SP_misc_insane(edict_t *self)
 	else
 	{
 		walkmonster_start(self);
-		self->s.skinnum = randk() % 3;
+		self->s.skinnum = randk_s(RANDK_AI) % 3;
 	}
 }
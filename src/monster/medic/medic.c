@@ -56,7 +56,7 @@ medic_footstep(edict_t *self)
 		sound_step2 = gi.soundindex("medic/step2.wav");
 	}
 
-	if (randk() % 2 == 0)
+	if (randk_s(RANDK_AI) % 2 == 0)
 	{
 		gi.sound(self, CHAN_BODY, sound_step, 1, ATTN_NORM, 0);
 	}
@@ -90,7 +90,7 @@ medic_FindDeadMonster(edict_t *self)
 			continue;
 		}
 
-		if (ent->monsterinfo.aiflags & AI_GOOD_GUY)
+		if (ent->monsterinfo->aiflags & AI_GOOD_GUY)
 		{
 			continue;
 		}
@@ -150,7 +150,7 @@ medic_idle(edict_t *self)
 	{
 		self->enemy = ent;
 		self->enemy->owner = self;
-		self->monsterinfo.aiflags |= AI_MEDIC;
+		self->monsterinfo->aiflags |= AI_MEDIC;
 		FoundTarget(self);
 	}
 }
@@ -176,7 +176,7 @@ medic_search(edict_t *self)
 			self->oldenemy = self->enemy;
 			self->enemy = ent;
 			self->enemy->owner = self;
-			self->monsterinfo.aiflags |= AI_MEDIC;
+			self->monsterinfo->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 		}
 	}
@@ -302,7 +302,7 @@ medic_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &medic_move_stand;
+	self->monsterinfo->currentmove = medic_move_stand.id;
 }
 
 static mframe_t medic_frames_walk[] = {
@@ -336,7 +336,7 @@ medic_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &medic_move_walk;
+	self->monsterinfo->currentmove = medic_move_walk.id;
 }
 
 static mframe_t medic_frames_run[] = {
@@ -364,7 +364,7 @@ medic_run(edict_t *self)
 		return;
 	}
 
-	if (!(self->monsterinfo.aiflags & AI_MEDIC))
+	if (!(self->monsterinfo->aiflags & AI_MEDIC))
 	{
 		edict_t *ent;
 
@@ -375,19 +375,19 @@ medic_run(edict_t *self)
 			self->oldenemy = self->enemy;
 			self->enemy = ent;
 			self->enemy->owner = self;
-			self->monsterinfo.aiflags |= AI_MEDIC;
+			self->monsterinfo->aiflags |= AI_MEDIC;
 			FoundTarget(self);
 			return;
 		}
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &medic_move_stand;
+		self->monsterinfo->currentmove = medic_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_run;
+		self->monsterinfo->currentmove = medic_move_run.id;
 	}
 }
 
@@ -462,14 +462,14 @@ medic_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &medic_move_pain1;
+		self->monsterinfo->currentmove = medic_move_pain1.id;
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_pain2;
+		self->monsterinfo->currentmove = medic_move_pain2.id;
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 }
@@ -623,7 +623,7 @@ medic_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &medic_move_death;
+	self->monsterinfo->currentmove = medic_move_death.id;
 }
 
 void
@@ -634,15 +634,15 @@ medic_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
+	self->monsterinfo->pausetime = level.time + 1;
 	gi.linkentity(self);
 }
 
@@ -654,13 +654,13 @@ medic_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -672,7 +672,7 @@ medic_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -713,7 +713,7 @@ medic_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	if (random() > 0.25)
+	if (random_s(RANDK_AI) > 0.25)
 	{
 		return;
 	}
@@ -724,7 +724,7 @@ medic_dodge(edict_t *self, edict_t *attacker, float eta)
 		FoundTarget(self);
 	}
 
-	self->monsterinfo.currentmove = &medic_move_duck;
+	self->monsterinfo->currentmove = medic_move_duck.id;
 }
 
 static mframe_t medic_frames_attackHyperBlaster[] = {
@@ -764,9 +764,9 @@ medic_continue(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() <= 0.95)
+		if (random_s(RANDK_AI) <= 0.95)
 		{
-			self->monsterinfo.currentmove = &medic_move_attackHyperBlaster;
+			self->monsterinfo->currentmove = medic_move_attackHyperBlaster.id;
 		}
 	}
 }
@@ -868,12 +868,12 @@ medic_cable_attack(edict_t *self)
 	if (self->s.frame == FRAME_attack43)
 	{
 		gi.sound(self->enemy, CHAN_AUTO, sound_hook_hit, 1, ATTN_NORM, 0);
-		self->enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		self->enemy->monsterinfo->aiflags |= AI_RESURRECTING;
 	}
 	else if (self->s.frame == FRAME_attack50)
 	{
 		self->enemy->spawnflags = 0;
-		self->enemy->monsterinfo.aiflags = 0;
+		self->enemy->monsterinfo->aiflags = 0;
 		self->enemy->target = NULL;
 		self->enemy->targetname = NULL;
 		self->enemy->combattarget = NULL;
@@ -888,7 +888,7 @@ medic_cable_attack(edict_t *self)
 			self->enemy->think(self->enemy);
 		}
 
-		self->enemy->monsterinfo.aiflags |= AI_RESURRECTING;
+		self->enemy->monsterinfo->aiflags |= AI_RESURRECTING;
 
 		if (self->oldenemy && self->oldenemy->client)
 		{
@@ -928,7 +928,13 @@ medic_hook_retract(edict_t *self)
 	}
 
 	gi.sound(self, CHAN_WEAPON, sound_hook_retract, 1, ATTN_NORM, 0);
-	self->enemy->monsterinfo.aiflags &= ~AI_RESURRECTING;
+
+	if (!self->enemy->inuse || !self->enemy->monsterinfo)
+	{
+		return;
+	}
+
+	self->enemy->monsterinfo->aiflags &= ~AI_RESURRECTING;
 }
 
 static mframe_t medic_frames_attackCable[] = {
@@ -978,13 +984,13 @@ medic_attack(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (self->monsterinfo->aiflags & AI_MEDIC)
 	{
-		self->monsterinfo.currentmove = &medic_move_attackCable;
+		self->monsterinfo->currentmove = medic_move_attackCable.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &medic_move_attackBlaster;
+		self->monsterinfo->currentmove = medic_move_attackBlaster.id;
 	}
 }
 
@@ -996,7 +1002,7 @@ medic_checkattack(edict_t *self)
 		return false;
 	}
 
-	if (self->monsterinfo.aiflags & AI_MEDIC)
+	if (self->monsterinfo->aiflags & AI_MEDIC)
 	{
 		medic_attack(self);
 		return true;
@@ -1022,6 +1028,8 @@ SP_monster_medic(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -1053,21 +1061,21 @@ SP_monster_medic(edict_t *self)
 	self->pain = medic_pain;
 	self->die = medic_die;
 
-	self->monsterinfo.stand = medic_stand;
-	self->monsterinfo.walk = medic_walk;
-	self->monsterinfo.run = medic_run;
-	self->monsterinfo.dodge = medic_dodge;
-	self->monsterinfo.attack = medic_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = medic_sight;
-	self->monsterinfo.idle = medic_idle;
-	self->monsterinfo.search = medic_search;
-	self->monsterinfo.checkattack = medic_checkattack;
+	self->monsterinfo->stand = medic_stand;
+	self->monsterinfo->walk = medic_walk;
+	self->monsterinfo->run = medic_run;
+	self->monsterinfo->dodge = medic_dodge;
+	self->monsterinfo->attack = medic_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = medic_sight;
+	self->monsterinfo->idle = medic_idle;
+	self->monsterinfo->search = medic_search;
+	self->monsterinfo->checkattack = medic_checkattack;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &medic_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = medic_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
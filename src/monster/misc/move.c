@@ -262,7 +262,7 @@ SV_movestep(edict_t *ent, vec3_t move, qboolean relink)
 	}
 
 	/* push down from a step height above the wished position */
-	if (!(ent->monsterinfo.aiflags & AI_NOSTEP))
+	if (!ent->monsterinfo || !(ent->monsterinfo->aiflags & AI_NOSTEP))
 	{
 		stepsize = STEPSIZE;
 	}
@@ -546,7 +546,7 @@ SV_NewChaseDir(edict_t *actor, edict_t *enemy, float dist)
 	}
 
 	/* try other directions */
-	if (((randk() & 3) & 1) || (fabsf(deltay) > fabsf(deltax)))
+	if (((randk_s(RANDK_AI) & 3) & 1) || (fabsf(deltay) > fabsf(deltax)))
 	{
 		tdir = d[1];
 		d[1] = d[2];
@@ -571,7 +571,7 @@ SV_NewChaseDir(edict_t *actor, edict_t *enemy, float dist)
 		return;
 	}
 
-	if (randk() & 1) /* randomly determine direction of search */
+	if (randk_s(RANDK_AI) & 1) /* randomly determine direction of search */
 	{
 		for (tdir = 0; tdir <= 315; tdir += 45)
 		{
@@ -658,7 +658,7 @@ M_MoveToGoal(edict_t *ent, float dist)
 	}
 
 	/* bump around... */
-	if (((randk() & 3) == 1) || !SV_StepDirection(ent, ent->ideal_yaw, dist))
+	if (((randk_s(RANDK_AI) & 3) == 1) || !SV_StepDirection(ent, ent->ideal_yaw, dist))
 	{
 		if (ent->inuse)
 		{
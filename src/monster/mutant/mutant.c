@@ -51,7 +51,7 @@ mutant_step(edict_t *self)
 		return;
 	}
 
-	n = (randk() + 1) % 3;
+	n = (randk_s(RANDK_AI) + 1) % 3;
 
 	if (n == 0)
 	{
@@ -169,7 +169,7 @@ mutant_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_stand;
+	self->monsterinfo->currentmove = mutant_move_stand.id;
 }
 
 void
@@ -180,9 +180,9 @@ mutant_idle_loop(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.75)
+	if (random_s(RANDK_AI) < 0.75)
 	{
-		self->monsterinfo.nextframe = FRAME_stand155;
+		self->monsterinfo->nextframe = FRAME_stand155;
 	}
 }
 
@@ -218,7 +218,7 @@ mutant_idle(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_idle;
+	self->monsterinfo->currentmove = mutant_move_idle.id;
 	gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 }
 
@@ -255,7 +255,7 @@ mutant_walk_loop(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_walk;
+	self->monsterinfo->currentmove = mutant_move_walk.id;
 }
 
 static mframe_t mutant_frames_start_walk[] = {
@@ -281,7 +281,7 @@ mutant_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_start_walk;
+	self->monsterinfo->currentmove = mutant_move_start_walk.id;
 }
 
 static mframe_t mutant_frames_run[] = {
@@ -309,13 +309,13 @@ mutant_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &mutant_move_stand;
+		self->monsterinfo->currentmove = mutant_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &mutant_move_run;
+		self->monsterinfo->currentmove = mutant_move_run.id;
 	}
 }
 
@@ -331,7 +331,7 @@ mutant_hit_left(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->mins[0], 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (10 + (randk_s(RANDK_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit, 1, ATTN_NORM, 0);
 	}
@@ -353,7 +353,7 @@ mutant_hit_right(edict_t *self)
 
 	VectorSet(aim, MELEE_DISTANCE, self->maxs[0], 8);
 
-	if (fire_hit(self, aim, (10 + (randk() % 5)), 100))
+	if (fire_hit(self, aim, (10 + (randk_s(RANDK_AI) % 5)), 100))
 	{
 		gi.sound(self, CHAN_WEAPON, sound_hit2, 1, ATTN_NORM, 0);
 	}
@@ -377,9 +377,9 @@ mutant_check_refire(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (random_s(RANDK_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attack09;
+		self->monsterinfo->nextframe = FRAME_attack09;
 	}
 }
 
@@ -409,7 +409,7 @@ mutant_melee(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_attack;
+	self->monsterinfo->currentmove = mutant_move_attack.id;
 }
 
 void
@@ -438,7 +438,7 @@ mutant_jump_touch(edict_t *self, edict_t *other,
 			VectorCopy(self->velocity, normal);
 			VectorNormalize(normal);
 			VectorMA(self->s.origin, self->maxs[0], normal, point);
-			damage = 40 + 10 * random();
+			damage = 40 + 10 * random_s(RANDK_AI);
 			T_Damage(other, self, self, self->velocity, point,
 					normal, damage, damage, 0, MOD_UNKNOWN);
 		}
@@ -448,7 +448,7 @@ mutant_jump_touch(edict_t *self, edict_t *other,
 	{
 		if (self->groundentity)
 		{
-			self->monsterinfo.nextframe = FRAME_attack02;
+			self->monsterinfo->nextframe = FRAME_attack02;
 			self->touch = NULL;
 		}
 
@@ -474,8 +474,8 @@ mutant_jump_takeoff(edict_t *self)
 	VectorScale(forward, 600, self->velocity);
 	self->velocity[2] = 250;
 	self->groundentity = NULL;
-	self->monsterinfo.aiflags |= AI_DUCKED;
-	self->monsterinfo.attack_finished = level.time + 3;
+	self->monsterinfo->aiflags |= AI_DUCKED;
+	self->monsterinfo->attack_finished = level.time + 3;
 	self->touch = mutant_jump_touch;
 }
 
@@ -490,18 +490,18 @@ mutant_check_landing(edict_t *self)
 	if (self->groundentity)
 	{
 		gi.sound(self, CHAN_WEAPON, sound_thud, 1, ATTN_NORM, 0);
-		self->monsterinfo.attack_finished = 0;
-		self->monsterinfo.aiflags &= ~AI_DUCKED;
+		self->monsterinfo->attack_finished = 0;
+		self->monsterinfo->aiflags &= ~AI_DUCKED;
 		return;
 	}
 
-	if (level.time > self->monsterinfo.attack_finished)
+	if (level.time > self->monsterinfo->attack_finished)
 	{
-		self->monsterinfo.nextframe = FRAME_attack02;
+		self->monsterinfo->nextframe = FRAME_attack02;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attack05;
+		self->monsterinfo->nextframe = FRAME_attack05;
 	}
 }
 
@@ -532,7 +532,7 @@ mutant_jump(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &mutant_move_jump;
+	self->monsterinfo->currentmove = mutant_move_jump.id;
 }
 
 qboolean
@@ -584,7 +584,7 @@ mutant_check_jump(edict_t *self)
 
 	if (distance > 100)
 	{
-		if (random() < 0.9)
+		if (random_s(RANDK_AI) < 0.9)
 		{
 			return false;
 		}
@@ -608,13 +608,13 @@ mutant_checkattack(edict_t *self)
 
 	if (mutant_check_melee(self))
 	{
-		self->monsterinfo.attack_state = AS_MELEE;
+		self->monsterinfo->attack_state = AS_MELEE;
 		return true;
 	}
 
 	if (mutant_check_jump(self))
 	{
-		self->monsterinfo.attack_state = AS_MISSILE;
+		self->monsterinfo->attack_state = AS_MISSILE;
 		return true;
 	}
 
@@ -699,22 +699,22 @@ mutant_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r < 0.33)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain1;
+		self->monsterinfo->currentmove = mutant_move_pain1.id;
 	}
 	else if (r < 0.66)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain2;
+		self->monsterinfo->currentmove = mutant_move_pain2.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &mutant_move_pain3;
+		self->monsterinfo->currentmove = mutant_move_pain3.id;
 	}
 }
 
@@ -820,13 +820,13 @@ mutant_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->takedamage = DAMAGE_YES;
 	self->s.skinnum = 1;
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &mutant_move_death1;
+		self->monsterinfo->currentmove = mutant_move_death1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &mutant_move_death2;
+		self->monsterinfo->currentmove = mutant_move_death2.id;
 	}
 }
 
@@ -847,6 +847,8 @@ SP_monster_mutant(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_swing = gi.soundindex("mutant/mutatck1.wav");
 	sound_hit = gi.soundindex("mutant/mutatck2.wav");
 	sound_hit2 = gi.soundindex("mutant/mutatck3.wav");
@@ -874,21 +876,21 @@ SP_monster_mutant(edict_t *self)
 	self->pain = mutant_pain;
 	self->die = mutant_die;
 
-	self->monsterinfo.stand = mutant_stand;
-	self->monsterinfo.walk = mutant_walk;
-	self->monsterinfo.run = mutant_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = mutant_jump;
-	self->monsterinfo.melee = mutant_melee;
-	self->monsterinfo.sight = mutant_sight;
-	self->monsterinfo.search = mutant_search;
-	self->monsterinfo.idle = mutant_idle;
-	self->monsterinfo.checkattack = mutant_checkattack;
+	self->monsterinfo->stand = mutant_stand;
+	self->monsterinfo->walk = mutant_walk;
+	self->monsterinfo->run = mutant_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = mutant_jump;
+	self->monsterinfo->melee = mutant_melee;
+	self->monsterinfo->sight = mutant_sight;
+	self->monsterinfo->search = mutant_search;
+	self->monsterinfo->idle = mutant_idle;
+	self->monsterinfo->checkattack = mutant_checkattack;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &mutant_move_stand;
+	self->monsterinfo->currentmove = mutant_move_stand.id;
 
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 	walkmonster_start(self);
 }
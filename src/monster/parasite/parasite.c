@@ -182,7 +182,7 @@ parasite_end_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_end_fidget;
+	self->monsterinfo->currentmove = parasite_move_end_fidget.id;
 }
 
 void
@@ -193,7 +193,7 @@ parasite_do_fidget(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_fidget;
+	self->monsterinfo->currentmove = parasite_move_fidget.id;
 }
 
 void
@@ -204,13 +204,13 @@ parasite_refidget(edict_t *self)
 		return;
 	}
 
-	if (random() <= 0.8)
+	if (random_s(RANDK_AI) <= 0.8)
 	{
-		self->monsterinfo.currentmove = &parasite_move_fidget;
+		self->monsterinfo->currentmove = parasite_move_fidget.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_end_fidget;
+		self->monsterinfo->currentmove = parasite_move_end_fidget.id;
 	}
 }
 
@@ -222,7 +222,7 @@ parasite_idle(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_start_fidget;
+	self->monsterinfo->currentmove = parasite_move_start_fidget.id;
 }
 
 static mframe_t parasite_frames_stand[] = {
@@ -261,7 +261,7 @@ parasite_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_stand;
+	self->monsterinfo->currentmove = parasite_move_stand.id;
 }
 
 static mframe_t parasite_frames_run[] = {
@@ -320,13 +320,13 @@ parasite_start_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &parasite_move_stand;
+		self->monsterinfo->currentmove = parasite_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_start_run;
+		self->monsterinfo->currentmove = parasite_move_start_run.id;
 	}
 }
 
@@ -338,13 +338,13 @@ parasite_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &parasite_move_stand;
+		self->monsterinfo->currentmove = parasite_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &parasite_move_run;
+		self->monsterinfo->currentmove = parasite_move_run.id;
 	}
 }
 
@@ -404,7 +404,7 @@ parasite_start_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_start_walk;
+	self->monsterinfo->currentmove = parasite_move_start_walk.id;
 }
 
 void
@@ -415,7 +415,7 @@ parasite_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_walk;
+	self->monsterinfo->currentmove = parasite_move_walk.id;
 }
 
 static mframe_t parasite_frames_pain1[] = {
@@ -466,7 +466,7 @@ parasite_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
 	}
@@ -475,7 +475,7 @@ parasite_pain(edict_t *self, edict_t *other /* unused */,
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_pain1;
+	self->monsterinfo->currentmove = parasite_move_pain1.id;
 }
 
 qboolean
@@ -656,7 +656,7 @@ parasite_attack(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &parasite_move_drain;
+	self->monsterinfo->currentmove = parasite_move_drain.id;
 }
 
 void
@@ -732,7 +732,7 @@ parasite_die(edict_t *self, edict_t *inflictor /* unused */,
 	gi.sound(self, CHAN_VOICE, sound_die, 1, ATTN_NORM, 0);
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.currentmove = &parasite_move_death;
+	self->monsterinfo->currentmove = parasite_move_death.id;
 }
 
 /*
@@ -752,6 +752,8 @@ SP_monster_parasite(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("parasite/parpain1.wav");
 	sound_pain2 = gi.soundindex("parasite/parpain2.wav");
 	sound_die = gi.soundindex("parasite/pardeth1.wav");
@@ -778,17 +780,17 @@ SP_monster_parasite(edict_t *self)
 	self->pain = parasite_pain;
 	self->die = parasite_die;
 
-	self->monsterinfo.stand = parasite_stand;
-	self->monsterinfo.walk = parasite_start_walk;
-	self->monsterinfo.run = parasite_start_run;
-	self->monsterinfo.attack = parasite_attack;
-	self->monsterinfo.sight = parasite_sight;
-	self->monsterinfo.idle = parasite_idle;
+	self->monsterinfo->stand = parasite_stand;
+	self->monsterinfo->walk = parasite_start_walk;
+	self->monsterinfo->run = parasite_start_run;
+	self->monsterinfo->attack = parasite_attack;
+	self->monsterinfo->sight = parasite_sight;
+	self->monsterinfo->idle = parasite_idle;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &parasite_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = parasite_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
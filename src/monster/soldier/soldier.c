@@ -61,7 +61,7 @@ soldier_footstep(edict_t *self)
 	}
 
 	int i;
-	i = randk() % 4;
+	i = randk_s(RANDK_AI) % 4;
 
 	if (i == 0)
 	{
@@ -90,7 +90,7 @@ soldier_idle(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.8)
+	if (random_s(RANDK_AI) > 0.8)
 	{
 		gi.sound(self, CHAN_VOICE, sound_idle, 1, ATTN_IDLE, 0);
 	}
@@ -220,14 +220,14 @@ soldier_stand(edict_t *self)
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldier_move_stand3) ||
-		(random() < 0.8))
+	if ((self->monsterinfo->currentmove == soldier_move_stand3.id) ||
+		(random_s(RANDK_AI) < 0.8))
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand1;
+		self->monsterinfo->currentmove = soldier_move_stand1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand3;
+		self->monsterinfo->currentmove = soldier_move_stand3.id;
 	}
 }
 
@@ -239,9 +239,9 @@ soldier_walk1_random(edict_t *self)
 		return;
 	}
 
-	if (random() > 0.1)
+	if (random_s(RANDK_AI) > 0.1)
 	{
-		self->monsterinfo.nextframe = FRAME_walk101;
+		self->monsterinfo->nextframe = FRAME_walk101;
 	}
 }
 
@@ -318,13 +318,13 @@ soldier_walk(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
-		self->monsterinfo.currentmove = &soldier_move_walk1;
+		self->monsterinfo->currentmove = soldier_move_walk1.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_walk2;
+		self->monsterinfo->currentmove = soldier_move_walk2.id;
 	}
 }
 
@@ -368,21 +368,21 @@ soldier_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &soldier_move_stand1;
+		self->monsterinfo->currentmove = soldier_move_stand1.id;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &soldier_move_walk1) ||
-		(self->monsterinfo.currentmove == &soldier_move_walk2) ||
-		(self->monsterinfo.currentmove == &soldier_move_start_run))
+	if ((self->monsterinfo->currentmove == soldier_move_walk1.id) ||
+		(self->monsterinfo->currentmove == soldier_move_walk2.id) ||
+		(self->monsterinfo->currentmove == soldier_move_start_run.id))
 	{
-		self->monsterinfo.currentmove = &soldier_move_run;
+		self->monsterinfo->currentmove = soldier_move_run.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_start_run;
+		self->monsterinfo->currentmove = soldier_move_start_run.id;
 	}
 }
 
@@ -497,11 +497,11 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 	if (level.time < self->pain_debounce_time)
 	{
 		if ((self->velocity[2] > 100) &&
-			((self->monsterinfo.currentmove == &soldier_move_pain1) ||
-			 (self->monsterinfo.currentmove == &soldier_move_pain2) ||
-			 (self->monsterinfo.currentmove == &soldier_move_pain3)))
+			((self->monsterinfo->currentmove == soldier_move_pain1.id) ||
+			 (self->monsterinfo->currentmove == soldier_move_pain2.id) ||
+			 (self->monsterinfo->currentmove == soldier_move_pain3.id)))
 		{
-			self->monsterinfo.currentmove = &soldier_move_pain4;
+			self->monsterinfo->currentmove = soldier_move_pain4.id;
 		}
 
 		return;
@@ -526,7 +526,7 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 
 	if (self->velocity[2] > 100)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain4;
+		self->monsterinfo->currentmove = soldier_move_pain4.id;
 		return;
 	}
 
@@ -535,19 +535,19 @@ soldier_pain(edict_t *self, edict_t *other /* unused */,
 		return; /* no pain anims in nightmare */
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r < 0.33)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain1;
+		self->monsterinfo->currentmove = soldier_move_pain1.id;
 	}
 	else if (r < 0.66)
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain2;
+		self->monsterinfo->currentmove = soldier_move_pain2.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_pain3;
+		self->monsterinfo->currentmove = soldier_move_pain3.id;
 	}
 }
 
@@ -632,8 +632,8 @@ soldier_fire(edict_t *self, int flash_number)
 		vectoangles(aim, dir);
 		AngleVectors(dir, forward, right, up);
 
-		r = crandom() * 1000;
-		u = crandom() * 500;
+		r = crandom_s(RANDK_AI) * 1000;
+		u = crandom_s(RANDK_AI) * 500;
 		VectorMA(start, 8192, forward, end);
 		VectorMA(end, r, right, end);
 		VectorMA(end, u, up, end);
@@ -654,22 +654,22 @@ soldier_fire(edict_t *self, int flash_number)
 	}
 	else
 	{
-		if (!(self->monsterinfo.aiflags & AI_HOLD_FRAME))
+		if (!(self->monsterinfo->aiflags & AI_HOLD_FRAME))
 		{
-			self->monsterinfo.pausetime = level.time + (3 + randk() % 8) * FRAMETIME;
+			self->monsterinfo->pausetime = level.time + (3 + randk_s(RANDK_AI) % 8) * FRAMETIME;
 		}
 
 		monster_fire_bullet(self, start, aim, 2, 4,
 				DEFAULT_BULLET_HSPREAD, DEFAULT_BULLET_VSPREAD,
 				flash_index);
 
-		if (level.time >= self->monsterinfo.pausetime)
+		if (level.time >= self->monsterinfo->pausetime)
 		{
-			self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+			self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 		}
 		else
 		{
-			self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+			self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 		}
 	}
 }
@@ -705,13 +705,13 @@ soldier_attack1_refire1(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (random_s(RANDK_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		self->monsterinfo->nextframe = FRAME_attak102;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak110;
+		self->monsterinfo->nextframe = FRAME_attak110;
 	}
 }
 
@@ -734,9 +734,9 @@ soldier_attack1_refire2(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (random_s(RANDK_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak102;
+		self->monsterinfo->nextframe = FRAME_attak102;
 	}
 }
 
@@ -794,13 +794,13 @@ soldier_attack2_refire1(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (random_s(RANDK_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		self->monsterinfo->nextframe = FRAME_attak204;
 	}
 	else
 	{
-		self->monsterinfo.nextframe = FRAME_attak216;
+		self->monsterinfo->nextframe = FRAME_attak216;
 	}
 }
 
@@ -823,9 +823,9 @@ soldier_attack2_refire2(edict_t *self)
 	}
 
 	if (((skill->value == SKILL_HARDPLUS) &&
-		 (random() < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
+		 (random_s(RANDK_AI) < 0.5)) || (range(self, self->enemy) == RANGE_MELEE))
 	{
-		self->monsterinfo.nextframe = FRAME_attak204;
+		self->monsterinfo->nextframe = FRAME_attak204;
 	}
 }
 
@@ -867,15 +867,15 @@ soldier_duck_down(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_DUCKED)
+	if (self->monsterinfo->aiflags & AI_DUCKED)
 	{
 		return;
 	}
 
-	self->monsterinfo.aiflags |= AI_DUCKED;
+	self->monsterinfo->aiflags |= AI_DUCKED;
 	self->maxs[2] -= 32;
 	self->takedamage = DAMAGE_YES;
-	self->monsterinfo.pausetime = level.time + 1;
+	self->monsterinfo->pausetime = level.time + 1;
 	gi.linkentity(self);
 }
 
@@ -887,7 +887,7 @@ soldier_duck_up(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.aiflags &= ~AI_DUCKED;
+	self->monsterinfo->aiflags &= ~AI_DUCKED;
 	self->maxs[2] += 32;
 	self->takedamage = DAMAGE_AIM;
 	gi.linkentity(self);
@@ -913,9 +913,9 @@ soldier_attack3_refire(edict_t *self)
 		return;
 	}
 
-	if ((level.time + 0.4) < self->monsterinfo.pausetime)
+	if ((level.time + 0.4) < self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.nextframe = FRAME_attak303;
+		self->monsterinfo->nextframe = FRAME_attak303;
 	}
 }
 
@@ -1000,7 +1000,7 @@ soldier_attack6_refire(edict_t *self)
 
 	if (skill->value == SKILL_HARDPLUS)
 	{
-		self->monsterinfo.nextframe = FRAME_runs03;
+		self->monsterinfo->nextframe = FRAME_runs03;
 	}
 }
 
@@ -1039,18 +1039,18 @@ soldier_attack(edict_t *self)
 
 	if (self->s.skinnum < 4)
 	{
-		if (random() < 0.5)
+		if (random_s(RANDK_AI) < 0.5)
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack1;
+			self->monsterinfo->currentmove = soldier_move_attack1.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack2;
+			self->monsterinfo->currentmove = soldier_move_attack2.id;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_attack4;
+		self->monsterinfo->currentmove = soldier_move_attack4.id;
 	}
 }
 
@@ -1062,7 +1062,7 @@ soldier_sight(edict_t *self, edict_t *other /* unused */)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_sight1, 1, ATTN_NORM, 0);
 	}
@@ -1073,9 +1073,9 @@ soldier_sight(edict_t *self, edict_t *other /* unused */)
 
 	if ((skill->value > SKILL_EASY) && (range(self, self->enemy) >= RANGE_MID))
 	{
-		if (random() > 0.5)
+		if (random_s(RANDK_AI) > 0.5)
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack6;
+			self->monsterinfo->currentmove = soldier_move_attack6.id;
 		}
 	}
 }
@@ -1088,13 +1088,13 @@ soldier_duck_hold(edict_t *self)
 		return;
 	}
 
-	if (level.time >= self->monsterinfo.pausetime)
+	if (level.time >= self->monsterinfo->pausetime)
 	{
-		self->monsterinfo.aiflags &= ~AI_HOLD_FRAME;
+		self->monsterinfo->aiflags &= ~AI_HOLD_FRAME;
 	}
 	else
 	{
-		self->monsterinfo.aiflags |= AI_HOLD_FRAME;
+		self->monsterinfo->aiflags |= AI_HOLD_FRAME;
 	}
 }
 
@@ -1124,7 +1124,7 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 		return;
 	}
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (r > 0.25)
 	{
@@ -1139,22 +1139,22 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 
 	if (skill->value == SKILL_EASY)
 	{
-		self->monsterinfo.currentmove = &soldier_move_duck;
+		self->monsterinfo->currentmove = soldier_move_duck.id;
 		return;
 	}
 
-	self->monsterinfo.pausetime = level.time + eta + 0.3;
-	r = random();
+	self->monsterinfo->pausetime = level.time + eta + 0.3;
+	r = random_s(RANDK_AI);
 
 	if (skill->value == SKILL_MEDIUM)
 	{
 		if (r > 0.33)
 		{
-			self->monsterinfo.currentmove = &soldier_move_duck;
+			self->monsterinfo->currentmove = soldier_move_duck.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack3;
+			self->monsterinfo->currentmove = soldier_move_attack3.id;
 		}
 
 		return;
@@ -1164,17 +1164,17 @@ soldier_dodge(edict_t *self, edict_t *attacker, float eta)
 	{
 		if (r > 0.66)
 		{
-			self->monsterinfo.currentmove = &soldier_move_duck;
+			self->monsterinfo->currentmove = soldier_move_duck.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &soldier_move_attack3;
+			self->monsterinfo->currentmove = soldier_move_attack3.id;
 		}
 
 		return;
 	}
 
-	self->monsterinfo.currentmove = &soldier_move_attack3;
+	self->monsterinfo->currentmove = soldier_move_attack3.id;
 }
 
 void
@@ -1553,31 +1553,31 @@ soldier_die(edict_t *self, edict_t *inflictor /* unused */,
 	if (fabs((self->s.origin[2] + self->viewheight) - point[2]) <= 4)
 	{
 		/* head shot */
-		self->monsterinfo.currentmove = &soldier_move_death3;
+		self->monsterinfo->currentmove = soldier_move_death3.id;
 		return;
 	}
 
-	n = randk() % 5;
+	n = randk_s(RANDK_AI) % 5;
 
 	if (n == 0)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death1;
+		self->monsterinfo->currentmove = soldier_move_death1.id;
 	}
 	else if (n == 1)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death2;
+		self->monsterinfo->currentmove = soldier_move_death2.id;
 	}
 	else if (n == 2)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death4;
+		self->monsterinfo->currentmove = soldier_move_death4.id;
 	}
 	else if (n == 3)
 	{
-		self->monsterinfo.currentmove = &soldier_move_death5;
+		self->monsterinfo->currentmove = soldier_move_death5.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &soldier_move_death6;
+		self->monsterinfo->currentmove = soldier_move_death6.id;
 	}
 }
 
@@ -1589,6 +1589,8 @@ SP_monster_soldier_x(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	// Force recaching at next footstep to ensure
 	// that the sound indices are correct.
 	sound_step = 0;
@@ -1597,7 +1599,7 @@ SP_monster_soldier_x(edict_t *self)
 	sound_step4 = 0;
 
 	self->s.modelindex = gi.modelindex("models/monsters/soldier/tris.md2");
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->scale = MODEL_SCALE;
 	VectorSet(self->mins, -16, -16, -24);
 	VectorSet(self->maxs, 16, 16, 32);
 	self->movetype = MOVETYPE_STEP;
@@ -1613,17 +1615,17 @@ SP_monster_soldier_x(edict_t *self)
 	self->pain = soldier_pain;
 	self->die = soldier_die;
 
-	self->monsterinfo.stand = soldier_stand;
-	self->monsterinfo.walk = soldier_walk;
-	self->monsterinfo.run = soldier_run;
-	self->monsterinfo.dodge = soldier_dodge;
-	self->monsterinfo.attack = soldier_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = soldier_sight;
+	self->monsterinfo->stand = soldier_stand;
+	self->monsterinfo->walk = soldier_walk;
+	self->monsterinfo->run = soldier_run;
+	self->monsterinfo->dodge = soldier_dodge;
+	self->monsterinfo->attack = soldier_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = soldier_sight;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.stand(self);
+	self->monsterinfo->stand(self);
 
 	walkmonster_start(self);
 }
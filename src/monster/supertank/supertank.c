@@ -59,7 +59,7 @@ supertank_search(edict_t *self)
 		return;
 	}
 
-	if (random() < 0.5)
+	if (random_s(RANDK_AI) < 0.5)
 	{
 		gi.sound(self, CHAN_VOICE, sound_search1, 1, ATTN_NORM, 0);
 	}
@@ -153,7 +153,7 @@ supertank_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_stand;
+	self->monsterinfo->currentmove = supertank_move_stand.id;
 }
 
 static mframe_t supertank_frames_run[] = {
@@ -222,7 +222,7 @@ supertank_forward(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_forward;
+	self->monsterinfo->currentmove = supertank_move_forward.id;
 }
 
 void
@@ -233,7 +233,7 @@ supertank_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &supertank_move_forward;
+	self->monsterinfo->currentmove = supertank_move_forward.id;
 }
 
 void
@@ -244,13 +244,13 @@ supertank_run(edict_t *self)
 		return;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &supertank_move_stand;
+		self->monsterinfo->currentmove = supertank_move_stand.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &supertank_move_run;
+		self->monsterinfo->currentmove = supertank_move_run.id;
 	}
 }
 
@@ -566,18 +566,18 @@ supertank_reattack1(edict_t *self)
 
 	if (visible(self, self->enemy))
 	{
-		if (random() < 0.9)
+		if (random_s(RANDK_AI) < 0.9)
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack1;
+			self->monsterinfo->currentmove = supertank_move_attack1.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &supertank_move_end_attack1;
+			self->monsterinfo->currentmove = supertank_move_end_attack1.id;
 		}
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &supertank_move_end_attack1;
+		self->monsterinfo->currentmove = supertank_move_end_attack1.id;
 	}
 }
 
@@ -603,7 +603,7 @@ supertank_pain(edict_t *self, edict_t *other /* unused */,
 	/* Lessen the chance of him going into his pain frames */
 	if (damage <= 25)
 	{
-		if (random() < 0.2)
+		if (random_s(RANDK_AI) < 0.2)
 		{
 			return;
 		}
@@ -629,17 +629,17 @@ supertank_pain(edict_t *self, edict_t *other /* unused */,
 	if (damage <= 10)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain1, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain1;
+		self->monsterinfo->currentmove = supertank_move_pain1.id;
 	}
 	else if (damage <= 25)
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain3, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain2;
+		self->monsterinfo->currentmove = supertank_move_pain2.id;
 	}
 	else
 	{
 		gi.sound(self, CHAN_VOICE, sound_pain2, 1, ATTN_NORM, 0);
-		self->monsterinfo.currentmove = &supertank_move_pain3;
+		self->monsterinfo->currentmove = supertank_move_pain3.id;
 	}
 }
 
@@ -736,18 +736,18 @@ supertank_attack(edict_t *self)
 
 	if (range <= 160)
 	{
-		self->monsterinfo.currentmove = &supertank_move_attack1;
+		self->monsterinfo->currentmove = supertank_move_attack1.id;
 	}
 	else
 	{
 		/* fire rockets more often at distance */
-		if (random() < 0.3)
+		if (random_s(RANDK_AI) < 0.3)
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack1;
+			self->monsterinfo->currentmove = supertank_move_attack1.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &supertank_move_attack2;
+			self->monsterinfo->currentmove = supertank_move_attack2.id;
 		}
 	}
 }
@@ -781,7 +781,7 @@ BossExplode(edict_t *self)
 
 	self->think = BossExplode;
 	VectorCopy(self->s.origin, org);
-	org[2] += 24 + (randk() & 15);
+	org[2] += 24 + (randk_s(RANDK_AI) & 15);
 
 	switch (self->count++)
 	{
@@ -862,7 +862,7 @@ supertank_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_NO;
 	self->count = 0;
-	self->monsterinfo.currentmove = &supertank_move_death;
+	self->monsterinfo->currentmove = supertank_move_death.id;
 }
 
 /*
@@ -882,6 +882,8 @@ SP_monster_supertank(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	sound_pain1 = gi.soundindex("bosstank/btkpain1.wav");
 	sound_pain2 = gi.soundindex("bosstank/btkpain2.wav");
 	sound_pain3 = gi.soundindex("bosstank/btkpain3.wav");
@@ -903,19 +905,19 @@ SP_monster_supertank(edict_t *self)
 
 	self->pain = supertank_pain;
 	self->die = supertank_die;
-	self->monsterinfo.stand = supertank_stand;
-	self->monsterinfo.walk = supertank_walk;
-	self->monsterinfo.run = supertank_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = supertank_attack;
-	self->monsterinfo.search = supertank_search;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = NULL;
+	self->monsterinfo->stand = supertank_stand;
+	self->monsterinfo->walk = supertank_walk;
+	self->monsterinfo->run = supertank_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = supertank_attack;
+	self->monsterinfo->search = supertank_search;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = NULL;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &supertank_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = supertank_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 }
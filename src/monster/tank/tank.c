@@ -144,7 +144,7 @@ tank_stand(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_stand;
+	self->monsterinfo->currentmove = tank_move_stand.id;
 }
 
 void tank_walk(edict_t *self);
@@ -215,7 +215,7 @@ tank_walk(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_walk;
+	self->monsterinfo->currentmove = tank_move_walk.id;
 }
 
 void tank_run(edict_t *self);
@@ -288,27 +288,27 @@ tank_run(edict_t *self)
 
 	if (self->enemy && self->enemy->client)
 	{
-		self->monsterinfo.aiflags |= AI_BRUTAL;
+		self->monsterinfo->aiflags |= AI_BRUTAL;
 	}
 	else
 	{
-		self->monsterinfo.aiflags &= ~AI_BRUTAL;
+		self->monsterinfo->aiflags &= ~AI_BRUTAL;
 	}
 
-	if (self->monsterinfo.aiflags & AI_STAND_GROUND)
+	if (self->monsterinfo->aiflags & AI_STAND_GROUND)
 	{
-		self->monsterinfo.currentmove = &tank_move_stand;
+		self->monsterinfo->currentmove = tank_move_stand.id;
 		return;
 	}
 
-	if ((self->monsterinfo.currentmove == &tank_move_walk) ||
-		(self->monsterinfo.currentmove == &tank_move_start_run))
+	if ((self->monsterinfo->currentmove == tank_move_walk.id) ||
+		(self->monsterinfo->currentmove == tank_move_start_run.id))
 	{
-		self->monsterinfo.currentmove = &tank_move_run;
+		self->monsterinfo->currentmove = tank_move_run.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &tank_move_start_run;
+		self->monsterinfo->currentmove = tank_move_start_run.id;
 	}
 }
 
@@ -396,7 +396,7 @@ tank_pain(edict_t *self, edict_t *other /* other */,
 
 	if (damage <= 30)
 	{
-		if (random() > 0.2)
+		if (random_s(RANDK_AI) > 0.2)
 		{
 			return;
 		}
@@ -428,15 +428,15 @@ tank_pain(edict_t *self, edict_t *other /* other */,
 
 	if (damage <= 30)
 	{
-		self->monsterinfo.currentmove = &tank_move_pain1;
+		self->monsterinfo->currentmove = tank_move_pain1.id;
 	}
 	else if (damage <= 60)
 	{
-		self->monsterinfo.currentmove = &tank_move_pain2;
+		self->monsterinfo->currentmove = tank_move_pain2.id;
 	}
 	else
 	{
-		self->monsterinfo.currentmove = &tank_move_pain3;
+		self->monsterinfo->currentmove = tank_move_pain3.id;
 	}
 }
 
@@ -649,16 +649,16 @@ tank_reattack_blaster(edict_t *self)
 		{
 			if (self->enemy->health > 0)
 			{
-				if (random() <= 0.6)
+				if (random_s(RANDK_AI) <= 0.6)
 				{
-					self->monsterinfo.currentmove = &tank_move_reattack_blast;
+					self->monsterinfo->currentmove = tank_move_reattack_blast.id;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_post_blast;
+	self->monsterinfo->currentmove = tank_move_attack_post_blast.id;
 }
 
 void
@@ -867,17 +867,17 @@ tank_refire_rocket(edict_t *self)
 		{
 			if (visible(self, self->enemy))
 			{
-				if (random() <= 0.4)
+				if (random_s(RANDK_AI) <= 0.4)
 				{
-					self->monsterinfo.currentmove =
-						&tank_move_attack_fire_rocket;
+					self->monsterinfo->currentmove =
+						tank_move_attack_fire_rocket.id;
 					return;
 				}
 			}
 		}
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_post_rocket;
+	self->monsterinfo->currentmove = tank_move_attack_post_rocket.id;
 }
 
 void
@@ -888,7 +888,7 @@ tank_doattack_rocket(edict_t *self)
 		return;
 	}
 
-	self->monsterinfo.currentmove = &tank_move_attack_fire_rocket;
+	self->monsterinfo->currentmove = tank_move_attack_fire_rocket.id;
 }
 
 void
@@ -905,52 +905,52 @@ tank_attack(edict_t *self)
 
 	if (self->enemy->health < 0)
 	{
-		self->monsterinfo.currentmove = &tank_move_attack_strike;
-		self->monsterinfo.aiflags &= ~AI_BRUTAL;
+		self->monsterinfo->currentmove = tank_move_attack_strike.id;
+		self->monsterinfo->aiflags &= ~AI_BRUTAL;
 		return;
 	}
 
 	VectorSubtract(self->enemy->s.origin, self->s.origin, vec);
 	range = VectorLength(vec);
 
-	r = random();
+	r = random_s(RANDK_AI);
 
 	if (range <= 125)
 	{
 		if (r < 0.4)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			self->monsterinfo->currentmove = tank_move_attack_chain.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			self->monsterinfo->currentmove = tank_move_attack_blast.id;
 		}
 	}
 	else if (range <= 250)
 	{
 		if (r < 0.5)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			self->monsterinfo->currentmove = tank_move_attack_chain.id;
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			self->monsterinfo->currentmove = tank_move_attack_blast.id;
 		}
 	}
 	else
 	{
 		if (r < 0.33)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_chain;
+			self->monsterinfo->currentmove = tank_move_attack_chain.id;
 		}
 		else if (r < 0.66)
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_pre_rocket;
+			self->monsterinfo->currentmove = tank_move_attack_pre_rocket.id;
 			self->pain_debounce_time = level.time + 5.0;    /* no pain for a while */
 		}
 		else
 		{
-			self->monsterinfo.currentmove = &tank_move_attack_blast;
+			self->monsterinfo->currentmove = tank_move_attack_blast.id;
 		}
 	}
 }
@@ -1058,7 +1058,7 @@ tank_die(edict_t *self, edict_t *inflictor /* unused */,
 	self->deadflag = DEAD_DEAD;
 	self->takedamage = DAMAGE_YES;
 
-	self->monsterinfo.currentmove = &tank_move_death;
+	self->monsterinfo->currentmove = tank_move_death.id;
 }
 
 /*
@@ -1080,6 +1080,8 @@ SP_monster_tank(edict_t *self)
 		return;
 	}
 
+	G_AllocMonsterInfo(self);
+
 	self->s.modelindex = gi.modelindex("models/monsters/tank/tris.md2");
 	VectorSet(self->mins, -32, -32, -16);
 	VectorSet(self->maxs, 32, 32, 72);
@@ -1118,19 +1120,19 @@ SP_monster_tank(edict_t *self)
 
 	self->pain = tank_pain;
 	self->die = tank_die;
-	self->monsterinfo.stand = tank_stand;
-	self->monsterinfo.walk = tank_walk;
-	self->monsterinfo.run = tank_run;
-	self->monsterinfo.dodge = NULL;
-	self->monsterinfo.attack = tank_attack;
-	self->monsterinfo.melee = NULL;
-	self->monsterinfo.sight = tank_sight;
-	self->monsterinfo.idle = tank_idle;
+	self->monsterinfo->stand = tank_stand;
+	self->monsterinfo->walk = tank_walk;
+	self->monsterinfo->run = tank_run;
+	self->monsterinfo->dodge = NULL;
+	self->monsterinfo->attack = tank_attack;
+	self->monsterinfo->melee = NULL;
+	self->monsterinfo->sight = tank_sight;
+	self->monsterinfo->idle = tank_idle;
 
 	gi.linkentity(self);
 
-	self->monsterinfo.currentmove = &tank_move_stand;
-	self->monsterinfo.scale = MODEL_SCALE;
+	self->monsterinfo->currentmove = tank_move_stand.id;
+	self->monsterinfo->scale = MODEL_SCALE;
 
 	walkmonster_start(self);
 
@@ -77,6 +77,7 @@ SP_FixCoopSpots(edict_t *self)
 			if ((!self->targetname) || (Q_stricmp(self->targetname, spot->targetname) != 0))
 			{
 				self->targetname = spot->targetname;
+				G_TargetsChanged(self->targetname);
 			}
 
 			return;
@@ -102,7 +103,7 @@ SP_CreateCoopSpots(edict_t *self)
 
 	if (Q_stricmp(level.mapname, "security") == 0)
 	{
-		spot = G_Spawn();
+		spot = G_SpawnLogic();
 		spot->classname = "info_player_coop";
 		spot->s.origin[0] = 188 - 64;
 		spot->s.origin[1] = -164;
@@ -110,7 +111,7 @@ SP_CreateCoopSpots(edict_t *self)
 		spot->targetname = "jail3";
 		spot->s.angles[1] = 90;
 
-		spot = G_Spawn();
+		spot = G_SpawnLogic();
 		spot->classname = "info_player_coop";
 		spot->s.origin[0] = 188 + 64;
 		spot->s.origin[1] = -164;
@@ -118,7 +119,7 @@ SP_CreateCoopSpots(edict_t *self)
 		spot->targetname = "jail3";
 		spot->s.angles[1] = 90;
 
-		spot = G_Spawn();
+		spot = G_SpawnLogic();
 		spot->classname = "info_player_coop";
 		spot->s.origin[0] = 188 + 128;
 		spot->s.origin[1] = -164;
@@ -126,6 +127,8 @@ SP_CreateCoopSpots(edict_t *self)
 		spot->targetname = "jail3";
 		spot->s.angles[1] = 90;
 
+		G_TargetsChanged("jail3");
+
 		return;
 	}
 }
@@ -142,7 +145,7 @@ SP_CreateCoopSpots(edict_t *self)
 void
 SP_CreateUnnamedSpawn(edict_t *self)
 {
-	edict_t *spot = G_Spawn();
+	edict_t *spot = G_SpawnLogic();
 
 	if (!self)
 	{
@@ -1008,6 +1011,8 @@ InitClientResp(gclient_t *client)
 	memset(&client->resp, 0, sizeof(client->resp));
 	client->resp.enterframe = level.framenum;
 	client->resp.coop_respawn = client->pers;
+	client->resp.cmd_tokens = cmd_burst->value;
+	client->resp.cmd_tokentime = level.time;
 }
 
 /*
@@ -1109,6 +1114,130 @@ PlayersRangeFromSpot(edict_t *spot)
 	return bestplayerdistance;
 }
 
+/*
+ * The deathmatch spots of the level, in edict order
+ * (the order G_Find() would return them), and their
+ * origins split into one array per axis so that
+ * SpotRanges() can be vectorized by the compiler.
+ */
+static edict_t **dm_spots;
+static float *dm_spots_x, *dm_spots_y, *dm_spots_z;
+static float *dm_ranges; /* scratch for SpotRanges() */
+static int num_dm_spots;
+
+/*
+ * Called once all entities of a level
+ * are spawned or loaded.
+ */
+void
+G_CacheDeathmatchSpots(void)
+{
+	edict_t *spot;
+	int i;
+
+	num_dm_spots = 0;
+	spot = NULL;
+
+	while ((spot = G_Find(spot, FOFS(classname),
+					"info_player_deathmatch")) != NULL)
+	{
+		num_dm_spots++;
+	}
+
+	if (!num_dm_spots)
+	{
+		return;
+	}
+
+	dm_spots = gi.TagMalloc(num_dm_spots * sizeof(*dm_spots), TAG_LEVEL);
+	dm_spots_x = gi.TagMalloc(num_dm_spots * sizeof(float), TAG_LEVEL);
+	dm_spots_y = gi.TagMalloc(num_dm_spots * sizeof(float), TAG_LEVEL);
+	dm_spots_z = gi.TagMalloc(num_dm_spots * sizeof(float), TAG_LEVEL);
+	dm_ranges = gi.TagMalloc(num_dm_spots * sizeof(float), TAG_LEVEL);
+
+	spot = NULL;
+
+	for (i = 0; i < num_dm_spots; i++)
+	{
+		spot = G_Find(spot, FOFS(classname), "info_player_deathmatch");
+
+		dm_spots[i] = spot;
+		dm_spots_x[i] = spot->s.origin[0];
+		dm_spots_y[i] = spot->s.origin[1];
+		dm_spots_z[i] = spot->s.origin[2];
+	}
+}
+
+/*
+ * PlayersRangeFromSpot() for all cached spots at
+ * once. The living players are collected once and
+ * each of them is checked against all spots, the
+ * squared distances are compared and the square
+ * root is only taken of the result.
+ */
+static void
+SpotRanges(float *ranges)
+{
+	vec3_t players[MAX_CLIENTS];
+	edict_t *player;
+	float dx, dy, dz, d;
+	int numplayers;
+	int n, i;
+
+	numplayers = 0;
+
+	for (n = 1; n <= maxclients->value; n++)
+	{
+		player = &g_edicts[n];
+
+		if (!player->inuse)
+		{
+			continue;
+		}
+
+		if (player->health <= 0)
+		{
+			continue;
+		}
+
+		VectorCopy(player->s.origin, players[numplayers]);
+		numplayers++;
+	}
+
+	if (!numplayers)
+	{
+		for (i = 0; i < num_dm_spots; i++)
+		{
+			ranges[i] = 9999999;
+		}
+
+		return;
+	}
+
+	for (i = 0; i < num_dm_spots; i++)
+	{
+		ranges[i] = 9999999.0f * 9999999.0f;
+	}
+
+	for (n = 0; n < numplayers; n++)
+	{
+		for (i = 0; i < num_dm_spots; i++)
+		{
+			dx = dm_spots_x[i] - players[n][0];
+			dy = dm_spots_y[i] - players[n][1];
+			dz = dm_spots_z[i] - players[n][2];
+			d = dx * dx + dy * dy + dz * dz;
+
+			ranges[i] = (d < ranges[i]) ? d : ranges[i];
+		}
+	}
+
+	for (i = 0; i < num_dm_spots; i++)
+	{
+		ranges[i] = (float)sqrt(ranges[i]);
+	}
+}
+
 /*
  * go to a random point, but NOT the two
  * points closest to other players
@@ -1117,37 +1246,40 @@ edict_t *
 SelectRandomDeathmatchSpawnPoint(void)
 {
 	edict_t *spot, *spot1, *spot2;
-	int count = 0;
+	int count;
 	int selection;
 	float range, range1, range2;
+	float *ranges;
+	int i;
 
-	spot = NULL;
+	if (!num_dm_spots)
+	{
+		return NULL;
+	}
+
+	ranges = dm_ranges;
+	SpotRanges(ranges);
+
+	count = num_dm_spots;
 	range1 = range2 = 99999;
 	spot1 = spot2 = NULL;
 
-	while ((spot = G_Find(spot, FOFS(classname),
-					"info_player_deathmatch")) != NULL)
+	for (i = 0; i < num_dm_spots; i++)
 	{
-		count++;
-		range = PlayersRangeFromSpot(spot);
+		range = ranges[i];
 
 		if (range < range1)
 		{
 			range1 = range;
-			spot1 = spot;
+			spot1 = dm_spots[i];
 		}
 		else if (range < range2)
 		{
 			range2 = range;
-			spot2 = spot;
+			spot2 = dm_spots[i];
 		}
 	}
 
-	if (!count)
-	{
-		return NULL;
-	}
-
 	if (count <= 2)
 	{
 		spot1 = spot2 = NULL;
@@ -1167,11 +1299,11 @@ SelectRandomDeathmatchSpawnPoint(void)
 
 	selection = randk() % count;
 
-	spot = NULL;
+	i = -1;
 
 	do
 	{
-		spot = G_Find(spot, FOFS(classname), "info_player_deathmatch");
+		spot = dm_spots[++i];
 
 		if ((spot == spot1) || (spot == spot2))
 		{
@@ -1187,22 +1319,27 @@ edict_t *
 SelectFarthestDeathmatchSpawnPoint(void)
 {
 	edict_t *bestspot;
-	float bestdistance, bestplayerdistance;
-	edict_t *spot;
+	float bestdistance;
+	float *ranges;
+	int i;
+
+	if (!num_dm_spots)
+	{
+		return NULL;
+	}
+
+	ranges = dm_ranges;
+	SpotRanges(ranges);
 
-	spot = NULL;
 	bestspot = NULL;
 	bestdistance = 0;
 
-	while ((spot = G_Find(spot, FOFS(classname),
-					"info_player_deathmatch")) != NULL)
+	for (i = 0; i < num_dm_spots; i++)
 	{
-		bestplayerdistance = PlayersRangeFromSpot(spot);
-
-		if (bestplayerdistance > bestdistance)
+		if (ranges[i] > bestdistance)
 		{
-			bestspot = spot;
-			bestdistance = bestplayerdistance;
+			bestspot = dm_spots[i];
+			bestdistance = ranges[i];
 		}
 	}
 
@@ -1213,9 +1350,7 @@ SelectFarthestDeathmatchSpawnPoint(void)
 
 	/* if there is a player just spawned on each and every start spot/
 	   we have no choice to turn one into a telefrag meltdown */
-	spot = G_Find(NULL, FOFS(classname), "info_player_deathmatch");
-
-	return spot;
+	return dm_spots[0];
 }
 
 edict_t *
@@ -1641,6 +1776,7 @@ PutClientInServer(edict_t *ent)
 	int i;
 	client_persistant_t saved;
 	client_respawn_t resp;
+	edict_t *chasers;
 
 	/* find a spawn point do it before setting
 	   health back up, so farthest ranging
@@ -1680,10 +1816,14 @@ PutClientInServer(edict_t *ent)
 	memcpy(userinfo, client->pers.userinfo, sizeof(userinfo));
 	ClientUserinfoChanged(ent, userinfo);
 
-	/* clear everything but the persistant data */
+	/* clear everything but the persistant data,
+	   we're still being chased */
+	SetChaseTarget(ent, NULL);
+	chasers = client->chasers;
 	saved = client->pers;
 	memset(client, 0, sizeof(*client));
 	client->pers = saved;
+	client->chasers = chasers;
 
 	if (client->pers.health <= 0)
 	{
@@ -1777,7 +1917,7 @@ PutClientInServer(edict_t *ent)
 	/* spawn a spectator */
 	if (client->pers.spectator)
 	{
-		client->chase_target = NULL;
+		SetChaseTarget(ent, NULL);
 
 		client->resp.spectator = true;
 
@@ -1804,6 +1944,35 @@ PutClientInServer(edict_t *ent)
 	koiWeaponUse(ent, client->pers.weapon);
 }
 
+/*
+ * Rebuilds g_clients[] from the client slots.
+ * Kept in slot order so that loops over it
+ * behave exactly like the old walks over
+ * g_edicts + 1 .. maxclients.
+ */
+void
+G_UpdateClientList(void)
+{
+	int i;
+	edict_t *ent;
+
+	g_numclients = 0;
+
+	for (i = 1; i <= game.maxclients; i++)
+	{
+		ent = g_edicts + i;
+
+		if (!ent->inuse || !ent->client)
+		{
+			continue;
+		}
+
+		g_clients[g_numclients++] = ent;
+	}
+
+	G_EffectClientsMoved();
+}
+
 /*
  * A client has just connected to the server in
  * deathmatch mode, so clear everything out before
@@ -1839,6 +2008,8 @@ ClientBeginDeathmatch(edict_t *ent)
 
 	gi.bprintf(PRINT_HIGH, "%s entered the game\n", ent->client->pers.netname);
 
+	G_UpdateClientList();
+
 	/* make sure all view stuff is valid */
 	ClientEndServerFrame(ent);
 }
@@ -1909,6 +2080,8 @@ ClientBegin(edict_t *ent)
 		}
 	}
 
+	G_UpdateClientList();
+
 	/* make sure all view stuff is valid */
 	ClientEndServerFrame(ent);
 }
@@ -2089,6 +2262,7 @@ ClientConnect(edict_t *ent, char *userinfo)
 
 	ent->svflags = 0; /* make sure we start with known default */
 	ent->client->pers.connected = true;
+	G_UpdateClientList();
 	return true;
 }
 
@@ -2125,6 +2299,9 @@ ClientDisconnect(edict_t *ent)
 	ent->inuse = false;
 	ent->classname = "disconnected";
 	ent->client->pers.connected = false;
+	G_UpdateClientList();
+
+	ClearChasers(ent);
 
 	playernum = ent - g_edicts - 1;
 	gi.configstring(CS_PLAYERSKINS + playernum, "");
@@ -2194,7 +2371,7 @@ void
 ClientThink(edict_t *ent, usercmd_t *ucmd)
 {
 	gclient_t *client;
-	edict_t *other;
+	edict_t *other, *next;
 	int i, j;
 	pmove_t pm;
 
@@ -2203,8 +2380,14 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 		return;
 	}
 
+	if (G_ReplayClientThink(ent, ucmd))
+	{
+		return;
+	}
+
 	level.current_entity = ent;
 	client = ent->client;
+	G_NetStatsSource(ent);
 
 	if (level.intermissiontime)
 	{
@@ -2373,7 +2556,7 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 
 			if (client->chase_target)
 			{
-				client->chase_target = NULL;
+				SetChaseTarget(ent, NULL);
 				client->ps.pmove.pm_flags &= ~PMF_NO_PREDICTION;
 			}
 			else
@@ -2412,15 +2595,12 @@ ClientThink(edict_t *ent, usercmd_t *ucmd)
 		}
 	}
 
-	/* update chase cam if being followed */
-	for (i = 1; i <= maxclients->value; i++)
+	/* update chase cam if being followed, UpdateChaseCam()
+	   may move the chaser to another target */
+	for (other = client->chasers; other; other = next)
 	{
-		other = g_edicts + i;
-
-		if (other->inuse && (other->client->chase_target == ent))
-		{
-			UpdateChaseCam(other);
-		}
+		next = other->client->chase_next;
+		UpdateChaseCam(other);
 	}
 }
 
@@ -97,16 +97,11 @@ BeginIntermission(edict_t *targ)
 	game.autosaved = false;
 
 	/* respawn any dead clients */
-	for (i = 0; i < maxclients->value; i++)
+	for (i = 0; i < g_numclients; i++)
 	{
 		edict_t *client;
 
-		client = g_edicts + 1 + i;
-
-		if (!client->inuse)
-		{
-			continue;
-		}
+		client = g_clients[i];
 
 		if (client->health <= 0)
 		{
@@ -121,17 +116,12 @@ BeginIntermission(edict_t *targ)
 	{
 		if (coop->value)
 		{
-			for (i = 0; i < maxclients->value; i++)
+			for (i = 0; i < g_numclients; i++)
 			{
 				int n;
 				edict_t *client;
 
-				client = g_edicts + 1 + i;
-
-				if (!client->inuse)
-				{
-					continue;
-				}
+				client = g_clients[i];
 
 				/* strip players of all keys between units */
 				for (n = 0; n < game.num_items; n++)
@@ -200,17 +190,11 @@ BeginIntermission(edict_t *targ)
 	}
 
 	/* move all clients to the intermission point */
-	for (i = 0; i < maxclients->value; i++)
+	for (i = 0; i < g_numclients; i++)
 	{
 		edict_t *client;
 
-		client = g_edicts + 1 + i;
-
-		if (!client->inuse)
-		{
-			continue;
-		}
-
+		client = g_clients[i];
 		MoveClientToIntermission(client);
 	}
 }
@@ -410,51 +394,59 @@ InventoryMessage(edict_t *ent)
 
 /* ======================================================================= */
 
+/*
+ * Stat groups recomputed and skipped by G_SetStats(),
+ * printed by the "sv hudstats" server command
+ */
+static unsigned int stats_computed;
+static unsigned int stats_skipped;
+
 void
 G_SetStats(edict_t *ent)
 {
+	gclient_t *client;
+	client_stats_t *last;
 	gitem_t *item;
 	int index, cells = 0;
 	int power_armor_type;
+	int armor_flash;
+	int timer_type, timer;
+	int helpicon;
+	int dirty, i;
 	float easing;
+	static cvar_t *gun;
 
 	if (!ent)
 	{
 		return;
 	}
 
-	/* health */
-	ent->client->ps.stats[STAT_HEALTH_ICON] = level.pic_health;
-	ent->client->ps.stats[STAT_HEALTH] = (ent->health < -99) ? -99 : ent->health;
+	client = ent->client;
+	last = &client->stats;
+	dirty = last->valid ? 0 : STATS_DIRTY_ALL;
 
-	if (HEALTH_HUD_EASING == true && ent->health > 0 && ent->health <= 100)
+	/* health */
+	if (last->health != ent->health)
 	{
-		/* send health to client through an easing function,
-		   a psychological trick to make things more dramatic */
-		easing = powf((float)(ent->health) / 100.0f, HEALTH_HUD_EASING_FACTOR);
-		ent->client->ps.stats[STAT_HEALTH] = (short)(ceilf(easing * 100.0f));
+		dirty |= STATS_DIRTY_HEALTH;
 	}
 
 	/* ammo */
-	if (!ent->client->weapon.ammo_item_index)
-	{
-		ent->client->ps.stats[STAT_AMMO_ICON] = 0;
-		ent->client->ps.stats[STAT_AMMO] = 0;
-	}
-	else
+	index = client->weapon.ammo_item_index;
+
+	if ((last->ammo_index != index) ||
+		(last->ammo != client->pers.inventory[index]))
 	{
-		item = &itemlist[ent->client->weapon.ammo_item_index];
-		ent->client->ps.stats[STAT_AMMO_ICON] = gi.imageindex(item->icon);
-		ent->client->ps.stats[STAT_AMMO] =
-			ent->client->pers.inventory[ent->client->weapon.ammo_item_index];
+		dirty |= STATS_DIRTY_AMMO;
 	}
 
-	/* armor */
+	/* armor, the power armor check runs every frame since
+	   it turns off the power armor when out of cells */
 	power_armor_type = PowerArmorType(ent);
 
 	if (power_armor_type)
 	{
-		cells = ent->client->pers.inventory[ITEM_INDEX(FindItem("cells"))];
+		cells = client->pers.inventory[cells_index];
 
 		if (cells == 0)
 		{
@@ -467,162 +459,300 @@ G_SetStats(edict_t *ent)
 	}
 
 	index = ArmorIndex(ent);
+	armor_flash = (power_armor_type && index) ? (level.framenum & 8) : 0;
 
-	if (power_armor_type && (!index || (level.framenum & 8)))
+	if ((last->power_armor_type != power_armor_type) ||
+		(last->cells != cells) || (last->armor_index != index) ||
+		(last->armor != client->pers.inventory[index]) ||
+		(last->armor_flash != armor_flash))
 	{
-		/* flash between power armor and other armor icon */
-		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex("i_powershield");
-		ent->client->ps.stats[STAT_ARMOR] = cells;
+		dirty |= STATS_DIRTY_ARMOR;
 	}
-	else if (index)
+
+	/* timers */
+	if (client->quad_framenum > level.framenum)
 	{
-		item = GetItemByIndex(index);
-		ent->client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex(item->icon);
-		ent->client->ps.stats[STAT_ARMOR] = ent->client->pers.inventory[index];
+		timer_type = 1;
+		timer = (client->quad_framenum - level.framenum) / 10;
+	}
+	else if (client->invincible_framenum > level.framenum)
+	{
+		timer_type = 2;
+		timer = (client->invincible_framenum - level.framenum) / 10;
+	}
+	else if (client->enviro_framenum > level.framenum)
+	{
+		timer_type = 3;
+		timer = (client->enviro_framenum - level.framenum) / 10;
+	}
+	else if (client->breather_framenum > level.framenum)
+	{
+		timer_type = 4;
+		timer = (client->breather_framenum - level.framenum) / 10;
 	}
 	else
 	{
-		ent->client->ps.stats[STAT_ARMOR_ICON] = 0;
-		ent->client->ps.stats[STAT_ARMOR] = 0;
+		timer_type = 0;
+		timer = 0;
 	}
 
-	/* pickup message */
-	if (level.time > ent->client->pickup_msg_time)
+	if ((last->timer_type != timer_type) || (last->timer != timer))
 	{
-		ent->client->ps.stats[STAT_PICKUP_ICON] = 0;
-		ent->client->ps.stats[STAT_PICKUP_STRING] = 0;
+		dirty |= STATS_DIRTY_TIMER;
 	}
 
-	/* timers */
-	if (ent->client->quad_framenum > level.framenum)
+	/* selected item */
+	if (last->selected_item != client->pers.selected_item)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quad");
-		ent->client->ps.stats[STAT_TIMER] =
-			(ent->client->quad_framenum - level.framenum) / 10;
+		dirty |= STATS_DIRTY_SELECTED;
 	}
-	else if (ent->client->invincible_framenum > level.framenum)
+
+	/* help icon / current weapon if not shown */
+	if (!gun)
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex(
-				"p_invulnerability");
-		ent->client->ps.stats[STAT_TIMER] =
-			(ent->client->invincible_framenum - level.framenum) / 10;
+		gun = gi.cvar("cl_gun", "2", 0);
 	}
-	else if (ent->client->enviro_framenum > level.framenum)
+
+	if (client->pers.helpchanged && (level.framenum & 8))
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_envirosuit");
-		ent->client->ps.stats[STAT_TIMER] =
-			(ent->client->enviro_framenum - level.framenum) / 10;
+		helpicon = 1;
 	}
-	else if (ent->client->breather_framenum > level.framenum)
+	else if (((client->pers.hand == CENTER_HANDED) ||
+			  (client->ps.fov > 91)) &&
+			 client->pers.weapon && (gun->value != 2))
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_rebreather");
-		ent->client->ps.stats[STAT_TIMER] =
-			(ent->client->breather_framenum - level.framenum) / 10;
+		helpicon = 2;
 	}
 	else
 	{
-		ent->client->ps.stats[STAT_TIMER_ICON] = 0;
-		ent->client->ps.stats[STAT_TIMER] = 0;
+		helpicon = 0;
 	}
 
-	/* selected item */
-	if (ent->client->pers.selected_item == -1)
+	if ((last->helpicon != helpicon) ||
+		((helpicon == 2) && (last->helpicon_weapon != client->pers.weapon)))
 	{
-		ent->client->ps.stats[STAT_SELECTED_ICON] = 0;
+		dirty |= STATS_DIRTY_HELPICON;
 	}
-	else
+
+	/* count the groups we are going to skip */
+	for (i = 0; i < 6; i++)
+	{
+		if (dirty & (1 << i))
+		{
+			stats_computed++;
+		}
+		else
+		{
+			stats_skipped++;
+		}
+	}
+
+	/* health */
+	if (dirty & STATS_DIRTY_HEALTH)
 	{
-		ent->client->ps.stats[STAT_SELECTED_ICON] =
-			gi.imageindex(itemlist[ent->client->pers.selected_item].icon);
+		last->health = ent->health;
+
+		client->ps.stats[STAT_HEALTH_ICON] = level.pic_health;
+		client->ps.stats[STAT_HEALTH] = (ent->health < -99) ? -99 : ent->health;
+
+		if (HEALTH_HUD_EASING == true && ent->health > 0 && ent->health <= 100)
+		{
+			/* send health to client through an easing function,
+			   a psychological trick to make things more dramatic */
+			easing = powf((float)(ent->health) / 100.0f, HEALTH_HUD_EASING_FACTOR);
+			client->ps.stats[STAT_HEALTH] = (short)(ceilf(easing * 100.0f));
+		}
 	}
 
-	ent->client->ps.stats[STAT_SELECTED_ITEM] = ent->client->pers.selected_item;
+	/* ammo */
+	if (dirty & STATS_DIRTY_AMMO)
+	{
+		last->ammo_index = client->weapon.ammo_item_index;
+		last->ammo = client->pers.inventory[last->ammo_index];
+
+		if (!last->ammo_index)
+		{
+			client->ps.stats[STAT_AMMO_ICON] = 0;
+			client->ps.stats[STAT_AMMO] = 0;
+		}
+		else
+		{
+			item = &itemlist[last->ammo_index];
+			client->ps.stats[STAT_AMMO_ICON] = gi.imageindex(item->icon);
+			client->ps.stats[STAT_AMMO] = last->ammo;
+		}
+	}
+
+	/* armor */
+	if (dirty & STATS_DIRTY_ARMOR)
+	{
+		last->power_armor_type = power_armor_type;
+		last->cells = cells;
+		last->armor_index = index;
+		last->armor = client->pers.inventory[index];
+		last->armor_flash = armor_flash;
+
+		if (power_armor_type && (!index || armor_flash))
+		{
+			/* flash between power armor and other armor icon */
+			client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex("i_powershield");
+			client->ps.stats[STAT_ARMOR] = cells;
+		}
+		else if (index)
+		{
+			item = GetItemByIndex(index);
+			client->ps.stats[STAT_ARMOR_ICON] = gi.imageindex(item->icon);
+			client->ps.stats[STAT_ARMOR] = client->pers.inventory[index];
+		}
+		else
+		{
+			client->ps.stats[STAT_ARMOR_ICON] = 0;
+			client->ps.stats[STAT_ARMOR] = 0;
+		}
+	}
+
+	/* pickup message */
+	if (level.time > client->pickup_msg_time)
+	{
+		client->ps.stats[STAT_PICKUP_ICON] = 0;
+		client->ps.stats[STAT_PICKUP_STRING] = 0;
+	}
+
+	/* timers */
+	if (dirty & STATS_DIRTY_TIMER)
+	{
+		last->timer_type = timer_type;
+		last->timer = timer;
+
+		switch (timer_type)
+		{
+			case 1:
+				client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_quad");
+				break;
+			case 2:
+				client->ps.stats[STAT_TIMER_ICON] = gi.imageindex(
+						"p_invulnerability");
+				break;
+			case 3:
+				client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_envirosuit");
+				break;
+			case 4:
+				client->ps.stats[STAT_TIMER_ICON] = gi.imageindex("p_rebreather");
+				break;
+			default:
+				client->ps.stats[STAT_TIMER_ICON] = 0;
+				break;
+		}
+
+		client->ps.stats[STAT_TIMER] = timer;
+	}
+
+	/* selected item */
+	if (dirty & STATS_DIRTY_SELECTED)
+	{
+		last->selected_item = client->pers.selected_item;
+
+		if (client->pers.selected_item == -1)
+		{
+			client->ps.stats[STAT_SELECTED_ICON] = 0;
+		}
+		else
+		{
+			client->ps.stats[STAT_SELECTED_ICON] =
+				gi.imageindex(itemlist[client->pers.selected_item].icon);
+		}
+
+		client->ps.stats[STAT_SELECTED_ITEM] = client->pers.selected_item;
+	}
 
 	/* layouts */
-	ent->client->ps.stats[STAT_LAYOUTS] = 0;
+	client->ps.stats[STAT_LAYOUTS] = 0;
 
 	if (deathmatch->value)
 	{
-		if ((ent->client->pers.health <= 0) || level.intermissiontime ||
-			ent->client->showscores)
+		if ((client->pers.health <= 0) || level.intermissiontime ||
+			client->showscores)
 		{
-			ent->client->ps.stats[STAT_LAYOUTS] |= 1;
+			client->ps.stats[STAT_LAYOUTS] |= 1;
 		}
 
-		if (ent->client->showinventory && (ent->client->pers.health > 0))
+		if (client->showinventory && (client->pers.health > 0))
 		{
-			ent->client->ps.stats[STAT_LAYOUTS] |= 2;
+			client->ps.stats[STAT_LAYOUTS] |= 2;
 		}
 	}
 	else
 	{
-		if (ent->client->showscores || ent->client->showhelp)
+		if (client->showscores || client->showhelp)
 		{
-			ent->client->ps.stats[STAT_LAYOUTS] |= 1;
+			client->ps.stats[STAT_LAYOUTS] |= 1;
 		}
 
-		if (ent->client->showinventory && (ent->client->pers.health > 0))
+		if (client->showinventory && (client->pers.health > 0))
 		{
-			ent->client->ps.stats[STAT_LAYOUTS] |= 2;
+			client->ps.stats[STAT_LAYOUTS] |= 2;
 		}
 	}
 
 	/* frags */
-	ent->client->ps.stats[STAT_FRAGS] = ent->client->resp.score;
+	client->ps.stats[STAT_FRAGS] = client->resp.score;
 
 	/* help icon / current weapon if not shown */
-	if (ent->client->pers.helpchanged && (level.framenum & 8))
+	if (dirty & STATS_DIRTY_HELPICON)
 	{
-		ent->client->ps.stats[STAT_HELPICON] = gi.imageindex("i_help");
-	}
-	else if (((ent->client->pers.hand == CENTER_HANDED) ||
-			  (ent->client->ps.fov > 91)) &&
-			 ent->client->pers.weapon)
-	{
-		cvar_t *gun;
-		gun = gi.cvar("cl_gun", "2", 0);
+		last->helpicon = helpicon;
+		last->helpicon_weapon = client->pers.weapon;
 
-		if (gun->value != 2)
+		if (helpicon == 1)
+		{
+			client->ps.stats[STAT_HELPICON] = gi.imageindex("i_help");
+		}
+		else if (helpicon == 2)
 		{
-			ent->client->ps.stats[STAT_HELPICON] = gi.imageindex(
-					ent->client->pers.weapon->icon);
+			client->ps.stats[STAT_HELPICON] = gi.imageindex(
+					client->pers.weapon->icon);
 		}
 		else
 		{
-			ent->client->ps.stats[STAT_HELPICON] = 0;
+			client->ps.stats[STAT_HELPICON] = 0;
 		}
 	}
-	else
-	{
-		ent->client->ps.stats[STAT_HELPICON] = 0;
-	}
 
-	ent->client->ps.stats[STAT_SPECTATOR] = 0;
+	client->ps.stats[STAT_SPECTATOR] = 0;
+	last->valid = true;
+}
+
+void
+G_PrintStatsCounters(void)
+{
+	unsigned int total;
+
+	total = stats_computed + stats_skipped;
+
+	gi.cprintf(NULL, PRINT_HIGH, "HUD stat groups: %u computed, %u skipped (%.1f%%)\n",
+			stats_computed, stats_skipped,
+			total ? (100.0 * stats_skipped) / total : 0.0);
 }
 
 void
 G_CheckChaseStats(edict_t *ent)
 {
-	int i;
+	edict_t *other;
 
 	if (!ent)
 	{
 		return;
 	}
 
-	for (i = 1; i <= maxclients->value; i++)
+	for (other = ent->client->chasers; other; other = other->client->chase_next)
 	{
 		gclient_t *cl;
 
-		cl = g_edicts[i].client;
-
-		if (!g_edicts[i].inuse || (cl->chase_target != ent))
-		{
-			continue;
-		}
+		cl = other->client;
 
 		memcpy(cl->ps.stats, ent->client->ps.stats, sizeof(cl->ps.stats));
-		G_SetSpectatorStats(g_edicts + i);
+		cl->stats.valid = false; /* not our own stats anymore */
+		G_SetSpectatorStats(other);
 	}
 }
 
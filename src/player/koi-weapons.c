@@ -60,8 +60,11 @@
 #define KOI_NO_MUZZLE_FLASH 255
 #define KOI_NO_TRAIL 255
 
+#define KOI_WEAPONS_FILE "koi-weapons.txt" // In game directory, see koiWeaponLoad()
+#define KOI_WEAPONS_FILE_MAX (32 * 1024)
 
-static struct koiWeaponBehaviour KOI_BEHAVIOURS[KOI_WEAPONS_NO] = {
+
+static const struct koiWeaponBehaviour KOI_DEFAULT_BEHAVIOURS[KOI_WEAPONS_NO] = {
     {
         .print_name = "Blaster",
         .classname = "weapon_blaster",
@@ -332,6 +335,50 @@ static struct koiWeaponBehaviour KOI_BEHAVIOURS[KOI_WEAPONS_NO] = {
     },
 };
 
+// Working copy, defaults above plus whatever KOI_WEAPONS_FILE says.
+// Replaced as a whole by koiWeaponLoad(), and since koiWeaponState
+// only keeps an index to it, a reload between frames is safe
+static struct koiWeaponBehaviour KOI_BEHAVIOURS[KOI_WEAPONS_NO];
+
+
+// Fields that can be tuned from KOI_WEAPONS_FILE. Names, models,
+// sounds and ammo are left out, items are bound to them
+enum sFieldType
+{
+	FIELD_U8,
+	FIELD_FLOAT,
+};
+
+struct sField
+{
+	const char* name;
+	size_t offset;
+	enum sFieldType type;
+	float min;
+	float max;
+};
+
+#define KOFS(x) offsetof(struct koiWeaponBehaviour, x)
+
+static const struct sField KOI_FIELDS[] = {
+    {"pickup_drop_ammo", KOFS(pickup_drop_ammo), FIELD_U8, 0.0f, 255.0f},
+    {"fire_ammo", KOFS(fire_ammo), FIELD_U8, 0.0f, 255.0f},
+    {"cook_step", KOFS(cook_step), FIELD_FLOAT, 0.0f, 1.0f},
+    {"fire_delay", KOFS(fire_delay), FIELD_U8, 0.0f, 255.0f},
+    {"projectiles_no", KOFS(projectiles_no), FIELD_U8, 1.0f, 255.0f},
+    {"damage", KOFS(damage), FIELD_U8, 0.0f, 255.0f},
+    {"projectiles_spray", KOFS(projectiles_spray), FIELD_FLOAT, 0.0f, 360.0f},
+    {"recoil_step", KOFS(recoil_step), FIELD_FLOAT, 0.0f, 1.0f},
+    {"recoil_restore_step", KOFS(recoil_restore_step), FIELD_FLOAT, 0.0f, 1.0f},
+    {"spread", KOFS(spread), FIELD_FLOAT, 0.0f, 360.0f},
+    {"spread_crouch_scale", KOFS(spread_crouch_scale), FIELD_FLOAT, 0.0f, 10.0f},
+    {"view_recoil_scale", KOFS(view_recoil_scale), FIELD_FLOAT, 0.0f, 90.0f},
+    {"view_shake_scale", KOFS(view_shake_scale), FIELD_FLOAT, 0.0f, 90.0f},
+    {"magazine_size", KOFS(magazine_size), FIELD_U8, 0.0f, 255.0f},
+    {"reload_step", KOFS(reload_step), FIELD_FLOAT, 0.0f, 1.0f},
+    {NULL, 0, FIELD_U8, 0.0f, 0.0f},
+};
+
 
 // ============================================
 
@@ -357,20 +404,20 @@ static float sEasing(float x, float k)
 	return (x - k * x) / (k - 2.0f * k * x + 1.0f);
 }
 
-static const struct koiWeaponBehaviour* sFindBehaviour(const char* classname)
+static struct gitem_s* s_blaster_item; // Fallback weapon, set by koiWeaponInit()
+
+static const struct koiWeaponBehaviour* sFindBehaviour(const struct gitem_s* item)
 {
-	const struct koiWeaponBehaviour* b = NULL;
+	// Bound at koiWeaponInit(), no need to compare strings
+	if (item->koi_behaviour < 0)
+		return NULL;
 
-	for (int i = 0; i < KOI_WEAPONS_NO; i += 1)
-	{
-		if (strcmp(classname, KOI_BEHAVIOURS[i].classname) == 0)
-		{
-			b = KOI_BEHAVIOURS + i;
-			break;
-		}
-	}
+	return KOI_BEHAVIOURS + item->koi_behaviour;
+}
 
-	return b;
+static int sItsOwnAmmo(const struct gitem_s* item)
+{
+	return (item->koi_ammo == ITEM_INDEX(item)) ? 1 : 0;
 }
 
 static size_t sBehaviourIndex(const struct koiWeaponBehaviour* b)
@@ -403,6 +450,281 @@ static void sPlaySound(struct edict_s* player, const char* filename)
 }
 
 
+void koiWeaponInit(void)
+{
+	// Called from InitItems(), once the item table is ready. Bind
+	// items to behaviours and ammo so that the rest of this file
+	// never looks up things by name
+	memcpy(KOI_BEHAVIOURS, KOI_DEFAULT_BEHAVIOURS, sizeof(KOI_BEHAVIOURS));
+
+	for (int i = 0; i < game.num_items; i += 1)
+	{
+		itemlist[i].koi_behaviour = -1;
+		itemlist[i].koi_ammo = 0;
+	}
+
+	for (int i = 0; i < KOI_WEAPONS_NO; i += 1)
+	{
+		const struct koiWeaponBehaviour* b = KOI_BEHAVIOURS + i;
+		struct gitem_s* item = FindItemByClassname((char*)b->classname);
+
+		if (item == NULL)
+		{
+			gi.dprintf("koiWeaponInit(): no item for '%s'\n", b->classname);
+			continue;
+		}
+
+		item->koi_behaviour = i;
+
+		if (b->ammo_classname != NULL)
+		{
+			struct gitem_s* ammo_item = FindItemByClassname((char*)b->ammo_classname);
+
+			if (ammo_item == NULL)
+				gi.dprintf("koiWeaponInit(): no ammo item '%s' for '%s'\n", b->ammo_classname, b->classname);
+			else
+				item->koi_ammo = ITEM_INDEX(ammo_item);
+		}
+	}
+
+	s_blaster_item = FindItemByClassname("weapon_blaster");
+
+	// Tuning from file, on top of the defaults
+	koiWeaponLoad();
+}
+
+
+static void sWeaponsFilename(char* out, size_t size)
+{
+	cvar_t* game_dir = gi.cvar("game", "", 0);
+
+	if (*game_dir->string == '\0')
+		Com_sprintf(out, (int)(size), "%s/%s", GAMEVERSION, KOI_WEAPONS_FILE);
+	else
+		Com_sprintf(out, (int)(size), "%s/%s", game_dir->string, KOI_WEAPONS_FILE);
+}
+
+static int sParseField(struct koiWeaponBehaviour* b, const char* key, const char* value, const char* filename)
+{
+	const struct sField* f;
+	char* end;
+
+	for (f = KOI_FIELDS; f->name != NULL; f += 1)
+	{
+		if (Q_stricmp(f->name, key) == 0)
+			break;
+	}
+
+	if (f->name == NULL)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: unknown field '%s'\n", filename, key);
+		return 1;
+	}
+
+	const float v = strtof(value, &end);
+
+	if (end == value || *end != '\0' || isfinite(v) == 0 || v < f->min || v > f->max)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: '%s' for '%s' out of range [%g, %g]\n", filename, value, key,
+		           (double)(f->min), (double)(f->max));
+		return 1;
+	}
+
+	switch (f->type)
+	{
+	case FIELD_U8: *(uint8_t*)((uint8_t*)(b) + f->offset) = (uint8_t)(v); break;
+	case FIELD_FLOAT: *(float*)((uint8_t*)(b) + f->offset) = v; break;
+	}
+
+	return 0;
+}
+
+static int sValidate(const struct koiWeaponBehaviour* b, const char* filename)
+{
+	// Things that individually are fine, but together
+	// will lock the weapon state machine
+	const int its_own_ammo = (b->ammo_classname != NULL && strcmp(b->ammo_classname, b->classname) == 0) ? 1 : 0;
+
+	if (its_own_ammo == 0 && b->fire_ammo != 0 && b->magazine_size >= b->fire_ammo && b->reload_step <= 0.0f)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: '%s' has a magazine but no 'reload_step'\n", filename, b->classname);
+		return 1;
+	}
+
+	if (b->ammo_classname == NULL && b->fire_ammo != 0)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: '%s' has no ammo, 'fire_ammo' should be zero\n", filename, b->classname);
+		return 1;
+	}
+
+	return 0;
+}
+
+int koiWeaponLoad(void)
+{
+	// Same format as the entities in a map:
+	//     {
+	//     "classname" "weapon_shotgun"
+	//     "damage" "4"
+	//     }
+	// Fields not in the file keep the default value. Everything
+	// is parsed into a staging copy that replaces the working one
+	// only if the whole file is valid
+
+	static char buffer[KOI_WEAPONS_FILE_MAX];
+	struct koiWeaponBehaviour staging[KOI_WEAPONS_NO];
+	char filename[MAX_OSPATH];
+	char key[MAX_TOKEN_CHARS];
+	char* data;
+	const char* token;
+	size_t size;
+	int errors = 0;
+	int blocks = 0;
+	FILE* fp;
+
+	sWeaponsFilename(filename, sizeof(filename));
+
+	if ((fp = Q_fopen(filename, "rb")) == NULL)
+	{
+		gi.dprintf("No '%s', using default weapons\n", filename);
+		return 1;
+	}
+
+	size = fread(buffer, 1, sizeof(buffer) - 1, fp);
+	buffer[size] = '\0';
+
+	if (feof(fp) == 0)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: file too big, max is %i bytes\n", filename, KOI_WEAPONS_FILE_MAX - 1);
+		fclose(fp);
+		return 1;
+	}
+
+	fclose(fp);
+
+	memcpy(staging, KOI_DEFAULT_BEHAVIOURS, sizeof(staging));
+	data = buffer;
+
+	while (1)
+	{
+		struct koiWeaponBehaviour* b = NULL;
+
+		token = COM_Parse(&data);
+		if (data == NULL)
+			break;
+
+		if (token[0] != '{')
+		{
+			gi.cprintf(NULL, PRINT_HIGH, "%s: found '%s' when expecting '{'\n", filename, token);
+			errors += 1;
+			break;
+		}
+
+		blocks += 1;
+
+		while (1)
+		{
+			token = COM_Parse(&data);
+			if (token[0] == '}')
+				break;
+
+			if (data == NULL)
+			{
+				gi.cprintf(NULL, PRINT_HIGH, "%s: EOF without closing brace\n", filename);
+				errors += 1;
+				goto done;
+			}
+
+			Q_strlcpy(key, token, sizeof(key));
+			token = COM_Parse(&data);
+
+			if (data == NULL || token[0] == '}')
+			{
+				gi.cprintf(NULL, PRINT_HIGH, "%s: no value for '%s'\n", filename, key);
+				errors += 1;
+				goto done;
+			}
+
+			// Classname first, selects what we are modifying
+			if (Q_stricmp(key, "classname") == 0)
+			{
+				b = NULL;
+
+				for (int i = 0; i < KOI_WEAPONS_NO; i += 1)
+				{
+					if (Q_stricmp(staging[i].classname, token) == 0)
+						b = staging + i;
+				}
+
+				if (b == NULL)
+				{
+					gi.cprintf(NULL, PRINT_HIGH, "%s: '%s' is not a weapon\n", filename, token);
+					errors += 1;
+				}
+			}
+			else if (b == NULL)
+			{
+				gi.cprintf(NULL, PRINT_HIGH, "%s: '%s' before a valid 'classname'\n", filename, key);
+				errors += 1;
+			}
+			else
+			{
+				errors += sParseField(b, key, token, filename);
+			}
+		}
+	}
+
+done:
+	for (int i = 0; i < KOI_WEAPONS_NO; i += 1)
+		errors += sValidate(staging + i, filename);
+
+	if (errors != 0)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "%s: %i error(s), weapons not modified\n", filename, errors);
+		return 1;
+	}
+
+	memcpy(KOI_BEHAVIOURS, staging, sizeof(KOI_BEHAVIOURS));
+	gi.cprintf(NULL, PRINT_HIGH, "%s: %i weapon(s) loaded\n", filename, blocks);
+	return 0;
+}
+
+void koiWeaponWrite(void)
+{
+	// Dumps the working table, a template for KOI_WEAPONS_FILE
+	char filename[MAX_OSPATH];
+	FILE* fp;
+
+	sWeaponsFilename(filename, sizeof(filename));
+
+	if ((fp = Q_fopen(filename, "wb")) == NULL)
+	{
+		gi.cprintf(NULL, PRINT_HIGH, "Couldn't open %s\n", filename);
+		return;
+	}
+
+	for (int i = 0; i < KOI_WEAPONS_NO; i += 1)
+	{
+		const struct koiWeaponBehaviour* b = KOI_BEHAVIOURS + i;
+
+		fprintf(fp, "// %s\n{\n\"classname\" \"%s\"\n", b->print_name, b->classname);
+
+		for (const struct sField* f = KOI_FIELDS; f->name != NULL; f += 1)
+		{
+			if (f->type == FIELD_U8)
+				fprintf(fp, "\"%s\" \"%u\"\n", f->name, (unsigned)(*((const uint8_t*)(b) + f->offset)));
+			else
+				fprintf(fp, "\"%s\" \"%.9g\"\n", f->name, (double)(*(const float*)((const uint8_t*)(b) + f->offset)));
+		}
+
+		fprintf(fp, "}\n\n");
+	}
+
+	fclose(fp);
+	gi.cprintf(NULL, PRINT_HIGH, "Wrote %s\n", filename);
+}
+
+
 void PlayerNoise(struct edict_s* who, vec3_t where, int type)
 {
 	(void)who;
@@ -415,7 +737,7 @@ qboolean koiWeaponPickup(struct edict_s* weapon_item_ent, struct edict_s* player
 {
 	// Use item classname to find an appropiate behaviour,
 	// this checks if is an item of a weapon under our control
-	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item_ent->item->classname);
+	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item_ent->item);
 
 	if (b == NULL)
 	{
@@ -433,7 +755,7 @@ qboolean koiWeaponPickup(struct edict_s* weapon_item_ent, struct edict_s* player
 	player_ent->client->pers.inventory[ITEM_INDEX(weapon_item_ent->item)] += 1;
 
 	// Add some ammo
-	if (strcmp(b->ammo_classname, b->classname) == 0)
+	if (sItsOwnAmmo(weapon_item_ent->item) == 1)
 	{
 		// Weapon is its own ammo, so we increase
 		// how much weapons of this kind we carry
@@ -443,12 +765,12 @@ qboolean koiWeaponPickup(struct edict_s* weapon_item_ent, struct edict_s* player
 		else
 			player_ent->client->pers.inventory[ITEM_INDEX(weapon_item_ent->item)] += (int)(b->pickup_drop_ammo) - 1;
 	}
-	else if (b->ammo_classname != NULL)
+	else if (weapon_item_ent->item->koi_ammo != 0)
 	{
 		// Normal weapon, we increase the magazine
 		// and the ammo inventory
 
-		struct gitem_s* ammo_item = FindItemByClassname(b->ammo_classname);
+		struct gitem_s* ammo_item = itemlist + weapon_item_ent->item->koi_ammo;
 		int* magazine = &player_ent->client->pers.magazines[sBehaviourIndex(b)];
 		int ammo_to_add = (int)(b->pickup_drop_ammo);
 
@@ -518,7 +840,7 @@ void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item)
 
 	// Find behaviour
 	const struct koiWeaponBehaviour* prev_b = sBehaviourFromIndex(state->behaviour_index);
-	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item->classname);
+	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item);
 
 	if (b == NULL)
 	{
@@ -532,10 +854,9 @@ void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item)
 		return;
 
 	// Honor this cvar, don't use an empty weapon
-	if (g_select_empty->value == 0 && b->ammo_classname != NULL)
+	if (g_select_empty->value == 0 && weapon_item->koi_ammo != 0)
 	{
-		const struct gitem_s* ammo_item = FindItemByClassname(b->ammo_classname);
-		const int available_ammo = player->client->pers.inventory[ITEM_INDEX(ammo_item)] +
+		const int available_ammo = player->client->pers.inventory[weapon_item->koi_ammo] +
 		                           (int)(player->client->pers.magazines[sBehaviourIndex(b)]);
 
 		if (available_ammo < (int)(b->fire_ammo))
@@ -553,10 +874,7 @@ void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item)
 		state->stage = KOI_WEAPON_TAKE;
 		state->restore_recoil = 1;
 
-		if (b->ammo_classname != NULL)
-			state->ammo_item_index = ITEM_INDEX(FindItemByClassname(b->ammo_classname));
-		else
-			state->ammo_item_index = 0;
+		state->ammo_item_index = (size_t)(weapon_item->koi_ammo);
 
 		state->behaviour_index = sBehaviourIndex(b);
 		// state->recoil = 1.0f; // Penalize change weapons
@@ -565,10 +883,7 @@ void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item)
 		state->fire_wait = 0;
 		state->cook_progress = 0.0f;
 
-		if (b->ammo_classname != NULL)
-			state->its_own_ammo = (strcmp(b->ammo_classname, b->classname) == 0) ? 1 : 0;
-		else
-			state->its_own_ammo = 0;
+		state->its_own_ammo = sItsOwnAmmo(weapon_item);
 
 		player->client->ps.stats[27] = 0;
 		player->client->ps.stats[28] = 0;
@@ -583,7 +898,7 @@ void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item)
 
 void koiWeaponDrop(struct edict_s* player, struct gitem_s* weapon_item)
 {
-	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item->classname);
+	const struct koiWeaponBehaviour* b = sFindBehaviour(weapon_item);
 
 	if (b == NULL)
 	{
@@ -604,7 +919,7 @@ void koiWeaponDrop(struct edict_s* player, struct gitem_s* weapon_item)
 	size_t ammo_index = 0;
 	int ammo_to_drop = 0;
 
-	if (strcmp(b->ammo_classname, b->classname) != 0)
+	if (sItsOwnAmmo(weapon_item) == 0)
 	{
 		// Ammo, just the magazine, even if empty
 		ammo_to_drop = player->client->pers.magazines[sBehaviourIndex(b)];
@@ -643,7 +958,7 @@ void koiWeaponDrop(struct edict_s* player, struct gitem_s* weapon_item)
 	    // b. We don't have ammo for it
 	    (ammo_index > 0 && player->client->pers.inventory[ammo_index] == 0))
 	{
-		koiWeaponUse(player, FindItemByClassname("weapon_blaster"));
+		koiWeaponUse(player, s_blaster_item);
 	}
 	else
 	{
@@ -693,8 +1008,8 @@ static void sHitscan(const struct edict_s* player, const struct koiWeaponBehavio
 	vec3_t direction;
 	vec3_t direction_forward;
 	{
-		const float q = frandk() * 2.0f * (float)(M_PI);               // Polar to avoid a square spread
-		const float r = powf(frandk(), 2.0f) * spread * state->recoil; // Bias towards centre
+		const float q = frandk_s(RANDK_WEAPONS) * 2.0f * (float)(M_PI);               // Polar to avoid a square spread
+		const float r = powf(frandk_s(RANDK_WEAPONS), 2.0f) * spread * state->recoil; // Bias towards centre
 		const float random_x = cosf(q) * r;
 		const float random_y = sinf(q) * r;
 
@@ -725,8 +1040,8 @@ static void sHitscan(const struct edict_s* player, const struct koiWeaponBehavio
 		start[2] += (float)(player->viewheight) - 4.0f;
 	}
 
-	// Muzzle flash
-	if (b->muzzle_flash != KOI_NO_MUZZLE_FLASH)
+	// Muzzle flash, skipped if nobody could see it
+	if (b->muzzle_flash != KOI_NO_MUZZLE_FLASH && G_EffectVisible(start, MULTICAST_PVS, EFFECT_MUZZLEFLASH))
 	{
 		gi.WriteByte(svc_muzzleflash);
 		gi.WriteShort(player - g_edicts);
@@ -750,7 +1065,7 @@ static void sHitscan(const struct edict_s* player, const struct koiWeaponBehavio
 				T_Damage(tr.ent, player, player, direction_forward, tr.endpos, tr.plane.normal, (int)(b->damage),
 				         knockback, DAMAGE_BULLET, means_of_death);
 			}
-			else
+			else if (G_EffectVisible(tr.endpos, MULTICAST_PVS, EFFECT_POINTDIR))
 			{
 				gi.WriteByte(svc_temp_entity);
 				gi.WriteByte((int)(b->impact_effect));
@@ -761,7 +1076,7 @@ static void sHitscan(const struct edict_s* player, const struct koiWeaponBehavio
 		}
 
 		// Trail
-		if (b->trail_effect != KOI_NO_TRAIL)
+		if (b->trail_effect != KOI_NO_TRAIL && G_EffectVisible(tr.endpos, MULTICAST_PVS, EFFECT_LINE))
 		{
 			gi.WriteByte(svc_temp_entity);
 			gi.WriteByte((int)(b->trail_effect));
@@ -771,8 +1086,8 @@ static void sHitscan(const struct edict_s* player, const struct koiWeaponBehavio
 		}
 
 		// Update direction, no fancy polar here
-		direction_forward[0] = direction[0] + (frandk() - 0.5f) * b->projectiles_spray;
-		direction_forward[1] = direction[1] + (frandk() - 0.5f) * b->projectiles_spray;
+		direction_forward[0] = direction[0] + (frandk_s(RANDK_WEAPONS) - 0.5f) * b->projectiles_spray;
+		direction_forward[1] = direction[1] + (frandk_s(RANDK_WEAPONS) - 0.5f) * b->projectiles_spray;
 
 		AngleVectors(direction_forward, direction_forward, NULL, NULL);
 	}
@@ -949,7 +1264,7 @@ static void sReloadStage(struct edict_s* player)
 		// no point in reload such weapon
 		if (state->its_own_ammo == 1)
 		{
-			koiWeaponUse(player, FindItemByClassname("weapon_blaster"));
+			koiWeaponUse(player, s_blaster_item);
 			return;
 		}
 
@@ -961,7 +1276,7 @@ static void sReloadStage(struct edict_s* player)
 			else
 				gi.cprintf(player, PRINT_HIGH, "No enough ammo for '%s'\n", b->print_name);
 
-			koiWeaponUse(player, FindItemByClassname("weapon_blaster"));
+			koiWeaponUse(player, s_blaster_item);
 			return;
 		}
 
@@ -1040,8 +1355,7 @@ void koiWeaponThink(struct edict_s* player)
 		player->client->ps.stats[27] = (short)(player->client->pers.magazines[state->behaviour_index]);
 
 		if (b->fire_ammo != 0)
-			player->client->ps.stats[28] =
-			    (short)(player->client->pers.inventory[ITEM_INDEX(FindItemByClassname(b->ammo_classname))]);
+			player->client->ps.stats[28] = (short)(player->client->pers.inventory[state->ammo_item_index]);
 		else
 			player->client->ps.stats[28] = (short)(0);
 
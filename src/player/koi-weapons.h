@@ -113,6 +113,10 @@ struct koiWeaponState
 
 #include "../header/local.h"
 
+void koiWeaponInit(void);
+int koiWeaponLoad(void);
+void koiWeaponWrite(void);
+
 qboolean koiWeaponPickup(struct edict_s* item_ent, struct edict_s* player_ent);
 void koiWeaponUse(struct edict_s* player, struct gitem_s* weapon_item);
 void koiWeaponDrop(struct edict_s* player, struct gitem_s* weapon_item);
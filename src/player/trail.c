@@ -56,7 +56,7 @@ PlayerTrail_Init(void)
 
 	for (n = 0; n < TRAIL_LENGTH; n++)
 	{
-		trail[n] = G_Spawn();
+		trail[n] = G_SpawnLogic();
 		trail[n]->classname = "player_trail";
 	}
 
@@ -64,6 +64,54 @@ PlayerTrail_Init(void)
 	trail_active = true;
 }
 
+/*
+ * The markers are logic entities and
+ * were reallocated by ReadLevel(), find
+ * them again. The newest set is last.
+ */
+void
+PlayerTrail_Restore(void)
+{
+	edict_t *found[TRAIL_LENGTH];
+	edict_t *e;
+	int n, newest;
+
+	trail_active = false;
+
+	if (deathmatch->value)
+	{
+		return;
+	}
+
+	n = 0;
+	e = NULL;
+
+	while ((e = G_Find(e, FOFS(classname), "player_trail")))
+	{
+		memmove(&found[0], &found[1], (TRAIL_LENGTH - 1) * sizeof(edict_t *));
+		found[TRAIL_LENGTH - 1] = e;
+		n++;
+	}
+
+	if (n < TRAIL_LENGTH)
+	{
+		return;
+	}
+
+	for (n = 0, newest = TRAIL_LENGTH - 1; n < TRAIL_LENGTH; n++)
+	{
+		trail[n] = found[n];
+
+		if (trail[n]->timestamp > found[newest]->timestamp)
+		{
+			newest = n;
+		}
+	}
+
+	trail_head = NEXT(newest);
+	trail_active = true;
+}
+
 void
 PlayerTrail_Add(vec3_t spot)
 {
@@ -114,7 +162,7 @@ PlayerTrail_PickFirst(edict_t *self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self->monsterinfo->trail_time)
 		{
 			marker = NEXT(marker);
 		}
@@ -155,7 +203,7 @@ PlayerTrail_PickNext(edict_t *self)
 
 	for (marker = trail_head, n = TRAIL_LENGTH; n; n--)
 	{
-		if (trail[marker]->timestamp <= self->monsterinfo.trail_time)
+		if (trail[marker]->timestamp <= self->monsterinfo->trail_time)
 		{
 			marker = NEXT(marker);
 		}
@@ -152,7 +152,7 @@ PlayerNoise_Verify(edict_t *who)
 
 	for (e = g_edicts + 1 + game.maxclients; e < &g_edicts[globals.num_edicts]; e++)
 	{
-		if (!e->inuse || strcmp(e->classname, "player_noise") != 0)
+		if (!e->inuse || (G_ClassAtom(e) != CN_player_noise))
 		{
 			continue;
 		}
@@ -71,7 +71,7 @@
  * load older savegames. This should be bumped if the files
  * in tables/ are changed, otherwise strange things may happen.
  */
-#define SAVEGAMEVER "YQ2-5"
+#define SAVEGAMEVER "YQ2-8"
 
 #ifndef BUILD_DATE
 #define BUILD_DATE __DATE__
@@ -178,6 +178,18 @@ static field_t clientfields[] = {
 	#include "tables/clientfields.h"
 };
 
+/*
+ * Fields of the out of line
+ * edict blocks to be saved
+ */
+static field_t monsterinfofields[] = {
+	#include "tables/monsterinfofields.h"
+};
+
+static field_t moveinfofields[] = {
+	#include "tables/moveinfofields.h"
+};
+
 /* ========================================================= */
 
 /*
@@ -239,6 +251,10 @@ InitGame(void)
 	flood_persecond = gi.cvar("flood_persecond", "4", 0);
 	flood_waitdelay = gi.cvar("flood_waitdelay", "10", 0);
 
+	/* command rate limiting */
+	cmd_rate = gi.cvar("cmd_rate", "10", 0);
+	cmd_burst = gi.cvar("cmd_burst", "30", 0);
+
 	/* dm map list */
 	sv_maplist = gi.cvar("sv_maplist", "", 0);
 
@@ -246,10 +262,23 @@ InitGame(void)
 	aimfix = gi.cvar("aimfix", "0", CVAR_ARCHIVE);
 	g_machinegun_norecoil = gi.cvar("g_machinegun_norecoil", "0", CVAR_ARCHIVE);
 	g_swap_speed = gi.cvar("g_swap_speed", "1", 0);
+	g_framestats = gi.cvar("g_framestats", "0", 0);
+
+	/* replays */
+	G_ReplayInit();
+
+	/* network accounting */
+	G_NetStatsInit();
 
 	/* items */
 	InitItems();
 
+	/* monster animations */
+	M_InitMoves();
+
+	/* classname atoms */
+	G_InitClassAtoms();
+
 	game.helpmessage1[0] = 0;
 	game.helpmessage2[0] = 0;
 
@@ -259,6 +288,10 @@ InitGame(void)
 	globals.edicts = g_edicts;
 	globals.max_edicts = game.maxentities;
 
+	/* trigger contacts, one per edict */
+	G_InitTriggerCache();
+	G_InitPierceCache();
+
 	/* initialize all clients for this game */
 	game.maxclients = maxclients->value;
 	game.clients = gi.TagMalloc(game.maxclients * sizeof(game.clients[0]), TAG_GAME);
@@ -334,6 +367,22 @@ GetMmoveByAddress(mmove_t *adr)
 	return NULL;
 }
 
+/*
+ * Helper function to walk all
+ * mmove_t structs, returns NULL
+ * after the last one.
+ */
+mmove_t *
+GetMmoveByIndex(int index)
+{
+	if ((index < 0) || (index >= (int)(sizeof(mmoveList) / sizeof(mmoveList[0]))))
+	{
+		return NULL;
+	}
+
+	return mmoveList[index].mmovePtr;
+}
+
 /*
  * Helper function to get the
  * pointer to a mmove_t struct
@@ -411,7 +460,7 @@ WriteField1(FILE *f, field_t *field, byte *base)
 			}
 			else
 			{
-				index = *(edict_t **)p - g_edicts;
+				index = G_NumForEdict(*(edict_t **)p);
 			}
 
 			*(int *)p = index;
@@ -605,7 +654,7 @@ ReadField(FILE *f, field_t *field, byte *base)
 			}
 			else
 			{
-				*(edict_t **)p = &g_edicts[index];
+				*(edict_t **)p = G_EdictNum(index);
 			}
 
 			break;
@@ -829,6 +878,9 @@ ReadGame(const char *filename)
 		{"YQ2-3", 3},
 		{"YQ2-4", 4},
 		{"YQ2-5", 5},
+		{"YQ2-6", 6},
+		{"YQ2-7", 7},
+		{"YQ2-8", 8},
 	};
 
 	for (i=0; i < sizeof(version_mappings)/sizeof(version_mappings[0]); ++i)
@@ -912,6 +964,11 @@ ReadGame(const char *filename)
 	for (i = 0; i < game.maxclients; i++)
 	{
 		ReadClient(f, &game.clients[i], save_ver);
+
+		/* edict pointers of the old game */
+		game.clients[i].chase_target = NULL;
+		game.clients[i].chasers = NULL;
+		game.clients[i].chase_next = NULL;
 	}
 
 	fclose(f);
@@ -919,6 +976,53 @@ ReadGame(const char *filename)
 
 /* ========================================================== */
 
+/*
+ * Helpers to write the out of line
+ * edict blocks into a file. Called
+ * by WriteEdict.
+ */
+static void
+WriteMonsterInfo(FILE *f, monsterinfo_t *info)
+{
+	field_t *field;
+	monsterinfo_t temp;
+
+	temp = *info;
+
+	for (field = monsterinfofields; field->name; field++)
+	{
+		WriteField1(f, field, (byte *)&temp);
+	}
+
+	fwrite(&temp, sizeof(temp), 1, f);
+
+	for (field = monsterinfofields; field->name; field++)
+	{
+		WriteField2(f, field, (byte *)info);
+	}
+}
+
+static void
+WriteMoveInfo(FILE *f, moveinfo_t *info)
+{
+	field_t *field;
+	moveinfo_t temp;
+
+	temp = *info;
+
+	for (field = moveinfofields; field->name; field++)
+	{
+		WriteField1(f, field, (byte *)&temp);
+	}
+
+	fwrite(&temp, sizeof(temp), 1, f);
+
+	for (field = moveinfofields; field->name; field++)
+	{
+		WriteField2(f, field, (byte *)info);
+	}
+}
+
 /*
  * Helper function to write the
  * edict into a file. Called by
@@ -947,6 +1051,18 @@ WriteEdict(FILE *f, edict_t *ent)
 	{
 		WriteField2(f, field, (byte *)ent);
 	}
+
+	/* the out of line blocks come last, in the
+	   block above their pointers are only flags */
+	if (ent->moveinfo)
+	{
+		WriteMoveInfo(f, ent->moveinfo);
+	}
+
+	if (ent->monsterinfo)
+	{
+		WriteMonsterInfo(f, ent->monsterinfo);
+	}
 }
 
 /*
@@ -1004,16 +1120,16 @@ WriteLevel(const char *filename)
 	/* write out level_locals_t */
 	WriteLevelLocals(f);
 
-	/* write out all the entities */
-	for (i = 0; i < globals.num_edicts; i++)
+	/* write out all the entities,
+	   the logic entities included */
+	for (ent = G_NextEdict(NULL); ent; ent = G_NextEdict(ent))
 	{
-		ent = &g_edicts[i];
-
 		if (!ent->inuse)
 		{
 			continue;
 		}
 
+		i = G_NumForEdict(ent);
 		fwrite(&i, sizeof(i), 1, f);
 		WriteEdict(f, ent);
 	}
@@ -1021,11 +1137,46 @@ WriteLevel(const char *filename)
 	i = -1;
 	fwrite(&i, sizeof(i), 1, f);
 
+	/* write out the delayed uses */
+	G_WriteDelayedUses(f);
+
 	fclose(f);
 }
 
 /* ========================================================== */
 
+/*
+ * Helpers to read the out of
+ * line edict blocks back into
+ * the memory. Called by
+ * ReadEdict.
+ */
+static void
+ReadMonsterInfo(FILE *f, monsterinfo_t *info)
+{
+	field_t *field;
+
+	fread(info, sizeof(*info), 1, f);
+
+	for (field = monsterinfofields; field->name; field++)
+	{
+		ReadField(f, field, (byte *)info);
+	}
+}
+
+static void
+ReadMoveInfo(FILE *f, moveinfo_t *info)
+{
+	field_t *field;
+
+	fread(info, sizeof(*info), 1, f);
+
+	for (field = moveinfofields; field->name; field++)
+	{
+		ReadField(f, field, (byte *)info);
+	}
+}
+
 /*
  * A helper function to
  * read the edict back
@@ -1043,6 +1194,26 @@ ReadEdict(FILE *f, edict_t *ent)
 	{
 		ReadField(f, field, (byte *)ent);
 	}
+
+	/* the stored pointers only tell
+	   which blocks follow the edict */
+	if (ent->moveinfo)
+	{
+		ent->moveinfo = NULL;
+		G_AllocMoveInfo(ent);
+		ReadMoveInfo(f, ent->moveinfo);
+	}
+
+	if (ent->monsterinfo)
+	{
+		ent->monsterinfo = NULL;
+		G_AllocMonsterInfo(ent);
+		ReadMonsterInfo(f, ent->monsterinfo);
+	}
+
+	/* the cached atom points into the old game */
+	ent->classatom = CN_NONE;
+	ent->classatom_of = NULL;
 }
 
 /*
@@ -1091,6 +1262,12 @@ ReadLevel(const char *filename)
 	/* free any dynamic memory allocated by
 	   loading the level  base state */
 	gi.FreeTags(TAG_LEVEL);
+	G_ClearTargetGraph();
+	G_ClearDelayedUses();
+	G_ClearPierceCache();
+	G_ClearTriggerCache();
+	G_ClearInfoPools();
+	G_ClearLogicEdicts();
 
 	/* wipe all the entities */
 	memset(g_edicts, 0, game.maxentities * sizeof(g_edicts[0]));
@@ -1122,6 +1299,15 @@ ReadLevel(const char *filename)
 			break;
 		}
 
+		if (entnum >= game.maxentities)
+		{
+			/* logic entities are never linked */
+			ent = G_EdictNum(entnum);
+			ReadEdict(f, ent);
+			ent->s.number = entnum;
+			continue;
+		}
+
 		if (entnum >= globals.num_edicts)
 		{
 			globals.num_edicts = entnum + 1;
@@ -1135,8 +1321,15 @@ ReadLevel(const char *filename)
 		gi.linkentity(ent);
 	}
 
+	/* load the delayed uses */
+	G_ReadDelayedUses(f);
+
 	fclose(f);
 
+	G_CacheDeathmatchSpots();
+	G_BuildTargetGraph();
+	PlayerTrail_Restore();
+
 	/* mark all clients as unconnected */
 	for (i = 0; i < maxclients->value; i++)
 	{
@@ -1145,11 +1338,11 @@ ReadLevel(const char *filename)
 		ent->client->pers.connected = false;
 	}
 
+	G_UpdateClientList();
+
 	/* do any load time things at this point */
-	for (i = 0; i < globals.num_edicts; i++)
+	for (ent = G_NextEdict(NULL); ent; ent = G_NextEdict(ent))
 	{
-		ent = &g_edicts[i];
-
 		if (!ent->inuse)
 		{
 			continue;
@@ -34,6 +34,8 @@ typedef struct
 	byte *funcPtr;
 } functionList_t;
 
+functionList_t *GetFunctionByAddress(byte *adr);
+
 /*
  * Connects a human readable
  * mmove_t string with the
@@ -77,18 +77,6 @@
 {"use", FOFS(use), F_FUNCTION, FFL_NOSPAWN},
 {"pain", FOFS(pain), F_FUNCTION, FFL_NOSPAWN},
 {"die", FOFS(die), F_FUNCTION, FFL_NOSPAWN},
-{"stand", FOFS(monsterinfo.stand), F_FUNCTION, FFL_NOSPAWN},
-{"idle", FOFS(monsterinfo.idle), F_FUNCTION, FFL_NOSPAWN},
-{"search", FOFS(monsterinfo.search), F_FUNCTION, FFL_NOSPAWN},
-{"walk", FOFS(monsterinfo.walk), F_FUNCTION, FFL_NOSPAWN},
-{"run", FOFS(monsterinfo.run), F_FUNCTION, FFL_NOSPAWN},
-{"dodge", FOFS(monsterinfo.dodge), F_FUNCTION, FFL_NOSPAWN},
-{"attack", FOFS(monsterinfo.attack), F_FUNCTION, FFL_NOSPAWN},
-{"melee", FOFS(monsterinfo.melee), F_FUNCTION, FFL_NOSPAWN},
-{"sight", FOFS(monsterinfo.sight), F_FUNCTION, FFL_NOSPAWN},
-{"checkattack", FOFS(monsterinfo.checkattack), F_FUNCTION, FFL_NOSPAWN},
-{"currentmove", FOFS(monsterinfo.currentmove), F_MMOVE, FFL_NOSPAWN},
-{"endfunc", FOFS(moveinfo.endfunc), F_FUNCTION, FFL_NOSPAWN},
 {"lip", STOFS(lip), F_INT, FFL_SPAWNTEMP},
 {"distance", STOFS(distance), F_INT, FFL_SPAWNTEMP},
 {"height", STOFS(height), F_INT, FFL_SPAWNTEMP},
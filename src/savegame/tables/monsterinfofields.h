@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 1997-2001 Id Software, Inc.
+ * Copyright (C) 2011 Yamagi Burmeister
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ * See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA
+ * 02111-1307, USA.
+ *
+ * =======================================================================
+ *
+ * Fields of the out of line monsterinfo to be saved.
+ *
+ * =======================================================================
+ */
+
+{"stand", MIOFS(stand), F_FUNCTION, FFL_NOSPAWN},
+{"idle", MIOFS(idle), F_FUNCTION, FFL_NOSPAWN},
+{"search", MIOFS(search), F_FUNCTION, FFL_NOSPAWN},
+{"walk", MIOFS(walk), F_FUNCTION, FFL_NOSPAWN},
+{"run", MIOFS(run), F_FUNCTION, FFL_NOSPAWN},
+{"dodge", MIOFS(dodge), F_FUNCTION, FFL_NOSPAWN},
+{"attack", MIOFS(attack), F_FUNCTION, FFL_NOSPAWN},
+{"melee", MIOFS(melee), F_FUNCTION, FFL_NOSPAWN},
+{"sight", MIOFS(sight), F_FUNCTION, FFL_NOSPAWN},
+{"checkattack", MIOFS(checkattack), F_FUNCTION, FFL_NOSPAWN},
+{"currentmove", MIOFS(currentmove), F_INT, FFL_NOSPAWN},
+{NULL, 0, F_INT, 0}
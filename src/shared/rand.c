@@ -8,49 +8,105 @@
  *
  * =======================================================================
  *
- * KISS PRNG, as devised by Dr. George Marsaglia
+ * KISS PRNG, as devised by Dr. George Marsaglia. This is the compact
+ * 64 bit variant (MWC + XSH + CNG, 32 bytes of state) instead of the
+ * one with a 16 MB MWC lag table. Every stream has its own state, so
+ * drawing numbers in one subsystem doesn't shift the others.
  *
  * =======================================================================
  */
 
 #include <stdint.h>
 
-#define QSIZE 0x200000
-#define CNG (cng = 6906969069ULL * cng + 13579)
-#define XS (xs ^= (xs << 13), xs ^= (xs >> 17), xs ^= (xs << 43))
-#define KISS (B64MWC() + CNG + XS)
+#include "../header/shared.h"
 
-static uint64_t QARY[QSIZE];
-static int j;
-static uint64_t carry;
-static uint64_t xs;
-static uint64_t cng;
+typedef struct
+{
+	uint64_t x; /* MWC */
+	uint64_t c; /* MWC carry */
+	uint64_t y; /* XSH */
+	uint64_t z; /* CNG */
+} randk_state_t;
+
+static randk_state_t streams[RANDK_NUM_STREAMS];
+
+static uint64_t
+KISS(randk_state_t *s)
+{
+	uint64_t t;
+
+	/* MWC */
+	t = (s->x << 58) + s->c;
+	s->c = s->x >> 6;
+	s->x += t;
+	s->c += (s->x < t);
+
+	/* XSH */
+	s->y ^= s->y << 13;
+	s->y ^= s->y >> 17;
+	s->y ^= s->y << 43;
+
+	/* CNG */
+	s->z = 6906969069ULL * s->z + 1234567;
+
+	return s->x + s->y + s->z;
+}
 
+/*
+ * SplitMix64, spreads a small
+ * seed over the whole state.
+ */
 static uint64_t
-B64MWC(void)
+SplitMix(uint64_t *v)
 {
-	uint64_t t, x;
+	uint64_t z;
+
+	z = (*v += 0x9E3779B97F4A7C15ULL);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
 
-	j = (j + 1) & (QSIZE - 1);
-	x = QARY[j];
-	t = (x << 28) + carry;
-	carry = (x >> 36) - (t < x);
-	return QARY[j] = t - x;
+	return z ^ (z >> 31);
 }
 
 /*
  * Generate a pseudorandom
- * integer >0.
+ * integer >0 from a stream.
  */
 int
-randk(void)
+randk_s(randk_stream_t stream)
 {
-	int r;
+	return (int)(KISS(&streams[stream]) >> 33);
+}
 
-	r = (int)KISS;
-	r = (r < 0) ? (r * -1) : r;
+/*
+ * Generate a pseudorandom
+ * float between 0 and 1
+ * from a stream.
+ */
+float
+frandk_s(randk_stream_t stream)
+{
+	return (randk_s(stream)&32767)* (1.0/32767);
+}
 
-	return r;
+/* Generate a pseudorandom
+ * float between -1 and 1
+ * from a stream.
+ */
+float
+crandk_s(randk_stream_t stream)
+{
+	return (randk_s(stream)&32767)* (2.0/32767) - 1;
+}
+
+/*
+ * Generate a pseudorandom
+ * integer >0.
+ */
+int
+randk(void)
+{
+	return randk_s(RANDK_DEFAULT);
 }
 
 /*
@@ -61,7 +117,7 @@ randk(void)
 float
 frandk(void)
 {
-	return (randk()&32767)* (1.0/32767);
+	return frandk_s(RANDK_DEFAULT);
 }
 
 /* Generate a pseudorandom
@@ -70,28 +126,34 @@ frandk(void)
 float
 crandk(void)
 {
-	return (randk()&32767)* (2.0/32767) - 1;
+	return crandk_s(RANDK_DEFAULT);
 }
 
 /*
- * Seeds the PRNG
+ * Seeds all streams. The same seed
+ * always gives the same sequences.
  */
 void
-randk_seed(void)
+randk_seed(unsigned int seed)
 {
-	uint64_t i;
+	randk_state_t *s;
+	uint64_t v;
+	int i;
 
-	/* Seed QARY[] with CNG+XS: */
-	for (i = 0; i < QSIZE; i++)
+	for (i = 0; i < RANDK_NUM_STREAMS; i++)
 	{
-		QARY[i] = CNG + XS;
-	}
+		s = &streams[i];
+		v = ((uint64_t)i << 32) | seed;
 
-	/* Run through several rounds
-	   to warm up the state */
-	for (i = 0; i < 256; i++)
-	{
-		randk();
+		s->x = SplitMix(&v);
+		s->c = SplitMix(&v) >> 6; /* carry stays below 2^58 */
+		s->y = SplitMix(&v);
+		s->z = SplitMix(&v);
+
+		/* XSH would be stuck at 0 */
+		if (!s->y)
+		{
+			s->y = 362436362436362436ULL;
+		}
 	}
 }
-
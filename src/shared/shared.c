@@ -28,6 +28,14 @@
 
 #include "../header/shared.h"
 
+/* SSE2 is only used if the compiler does all float
+   math with it, x87 would round differently and the
+   batch functions wouldn't match the single ones */
+#if (defined(__SSE2__) && defined(__SSE2_MATH__)) || defined(_M_X64)
+#define USE_SSE2_BATCH
+#include <emmintrin.h>
+#endif
+
 #define DEG2RAD(a) (a * M_PI) / 180.0F
 
 vec3_t vec3_origin = {0, 0, 0};
@@ -526,6 +534,179 @@ VectorNormalize2(vec3_t v, vec3_t out)
 	return VectorNormalize(out);
 }
 
+/* ============================================================================ */
+
+/*
+ * Batch versions of the vector functions, for n vectors
+ * at once. With SSE2 four vectors are done per step,
+ * otherwise it's plain loops the compiler may vectorize.
+ * Both do the same single precision operations in the
+ * same order as VectorLength(), VectorNormalize() and
+ * DotProduct(), so the results are bit-identical.
+ */
+
+#ifdef USE_SSE2_BATCH
+/*
+ * Four vec3_t are 12 floats in a row, these
+ * turn them into one register per axis and back.
+ */
+static inline void
+VectorLoad4(vec3_t *v, __m128 *x, __m128 *y, __m128 *z)
+{
+	__m128 a, b, c, t1, t2;
+
+	a = _mm_loadu_ps(&v[0][0]); /* x0 y0 z0 x1 */
+	b = _mm_loadu_ps(&v[0][0] + 4); /* y1 z1 x2 y2 */
+	c = _mm_loadu_ps(&v[0][0] + 8); /* z2 x3 y3 z3 */
+
+	t1 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(1, 1, 2, 2));
+	*x = _mm_shuffle_ps(a, t1, _MM_SHUFFLE(2, 0, 3, 0));
+
+	t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(0, 0, 1, 1));
+	t2 = _mm_shuffle_ps(b, c, _MM_SHUFFLE(2, 2, 3, 3));
+	*y = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+
+	t1 = _mm_shuffle_ps(a, b, _MM_SHUFFLE(1, 1, 2, 2));
+	t2 = _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 3, 0, 0));
+	*z = _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0));
+}
+
+static inline void
+VectorStore4(vec3_t *v, __m128 x, __m128 y, __m128 z)
+{
+	__m128 t1, t2;
+
+	t1 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0));
+	t2 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+	_mm_storeu_ps(&v[0][0], _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0)));
+
+	t1 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1));
+	t2 = _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2));
+	_mm_storeu_ps(&v[0][0] + 4, _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0)));
+
+	t1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+	t2 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+	_mm_storeu_ps(&v[0][0] + 8, _mm_shuffle_ps(t1, t2, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+
+static inline __m128
+VectorLength4(__m128 x, __m128 y, __m128 z)
+{
+	__m128 len;
+
+	len = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)),
+			_mm_mul_ps(z, z));
+
+	return _mm_sqrt_ps(len);
+}
+#endif
+
+void
+VectorLengthN(vec3_t *v, vec_t *out, int n)
+{
+	int i = 0;
+
+#ifdef USE_SSE2_BATCH
+	__m128 x, y, z;
+
+	for ( ; i + 4 <= n; i += 4)
+	{
+		VectorLoad4(v + i, &x, &y, &z);
+		_mm_storeu_ps(out + i, VectorLength4(x, y, z));
+	}
+#endif
+
+	for ( ; i < n; i++)
+	{
+		out[i] = VectorLength(v[i]);
+	}
+}
+
+/*
+ * lengths may be NULL.
+ */
+void
+VectorNormalizeN(vec3_t *v, vec_t *lengths, int n)
+{
+	vec_t length;
+	int i = 0;
+
+#ifdef USE_SSE2_BATCH
+	__m128 x, y, z, len, ilen, mask;
+
+	for ( ; i + 4 <= n; i += 4)
+	{
+		VectorLoad4(v + i, &x, &y, &z);
+		len = VectorLength4(x, y, z);
+
+		/* zero length vectors are left alone */
+		mask = _mm_cmpneq_ps(len, _mm_setzero_ps());
+		ilen = _mm_div_ps(_mm_set1_ps(1.0f), len);
+
+		x = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(x, ilen)), _mm_andnot_ps(mask, x));
+		y = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(y, ilen)), _mm_andnot_ps(mask, y));
+		z = _mm_or_ps(_mm_and_ps(mask, _mm_mul_ps(z, ilen)), _mm_andnot_ps(mask, z));
+
+		VectorStore4(v + i, x, y, z);
+
+		if (lengths)
+		{
+			_mm_storeu_ps(lengths + i, len);
+		}
+	}
+#endif
+
+	for ( ; i < n; i++)
+	{
+		length = VectorNormalize(v[i]);
+
+		if (lengths)
+		{
+			lengths[i] = length;
+		}
+	}
+}
+
+void
+DotProductN(vec3_t *a, vec3_t *b, vec_t *out, int n)
+{
+	int i = 0;
+
+#ifdef USE_SSE2_BATCH
+	__m128 ax, ay, az, bx, by, bz;
+
+	for ( ; i + 4 <= n; i += 4)
+	{
+		VectorLoad4(a + i, &ax, &ay, &az);
+		VectorLoad4(b + i, &bx, &by, &bz);
+
+		_mm_storeu_ps(out + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx),
+				_mm_mul_ps(ay, by)), _mm_mul_ps(az, bz)));
+	}
+#endif
+
+	for ( ; i < n; i++)
+	{
+		out[i] = DotProduct(a[i], b[i]);
+	}
+}
+
+/*
+ * forward, right and up may be NULL. There's no
+ * SIMD sin/cos to use, so this only saves the calls.
+ */
+void
+AngleVectorsN(vec3_t *angles, vec3_t *forward, vec3_t *right, vec3_t *up, int n)
+{
+	int i;
+
+	for (i = 0; i < n; i++)
+	{
+		AngleVectors(angles[i], forward ? forward[i] : NULL,
+				right ? right[i] : NULL, up ? up[i] : NULL);
+	}
+}
+
 void
 VectorMA(vec3_t veca, float scale, vec3_t vecb, vec3_t vecc)
 {
@@ -1074,6 +1255,25 @@ Q_strcasecmp(char *s1, char *s2)
 	return Q_strncasecmp(s1, s2, 99999);
 }
 
+/*
+ * FNV-1a over the lowercased string, two
+ * strings equal under Q_stricmp() hash
+ * to the same value.
+ */
+unsigned int
+Q_strhash(const char *s)
+{
+	unsigned int hash = 2166136261u;
+
+	while (*s)
+	{
+		hash ^= (unsigned int)tolower((unsigned char)*s++);
+		hash *= 16777619u;
+	}
+
+	return hash;
+}
+
 void
 Com_sprintf(char *dest, int size, char *fmt, ...)
 {